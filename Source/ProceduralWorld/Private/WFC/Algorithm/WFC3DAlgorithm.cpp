@@ -6,6 +6,7 @@
 #include "WFC/Algorithm/WFC3DPropagation.h"
 #include "WFC/Algorithm/WFC3DFunctionMaps.h"
 #include "WFC/Data/WFC3DGrid.h"
+#include "WFC/Data/WFC3DGridStateCache.h"
 #include "Async/Async.h"
 #include "Engine/Engine.h"
 #include "WFC/Data/WFC3DModelDataAsset.h"
@@ -155,9 +156,13 @@ FWFC3DAlgorithmResult UWFC3DAlgorithm::ExecuteInternal(const FWFC3DAlgorithmCont
 			int32 CollapsedCount = 0;
 			int32 UnCollapsedCount = 0;
 
-			for (const FWFC3DCell& Cell : *AllCells)
+			for (int32 CellIndex = 0; CellIndex < AllCells->Num(); ++CellIndex)
 			{
-				if (Cell.bIsCollapsed)
+				if (!Grid->IsGridCell(CellIndex))
+				{
+					continue;
+				}
+				if (Grid->IsCollapsed(CellIndex))
 				{
 					CollapsedCount++;
 				}
@@ -216,14 +221,65 @@ FWFC3DAlgorithmResult UWFC3DAlgorithm::ExecuteInternal(const FWFC3DAlgorithmCont
 	// Grid->PrintGridInfo();
 	// // UE_LOG(LogTemp, Display, TEXT("======================BEFORE INIT PROPAGATION END=========================="));
 
-	WFC3DPropagateFunctions::ExecuteInitialPropagation(FWFC3DPropagationContext(Grid, ModelData, FIntVector::ZeroValue));
+	// 솔버 임시 데이터는 모두 SolverArena에서 할당
+	FWFC3DArenaScope ArenaScope(SolverArena);
+	SolverArena.Reset();
+	Result.CollapseResults.Reserve(TotalSteps);
+	Result.PropagationResults.Reserve(TotalSteps);
+
+	// 같은 ModelData / Dimension / 설정의 초기 전파 결과가 캐시되어 있으면 복원
+	if (!FWFC3DGridStateCache::RestoreInitialState(Grid))
+	{
+		FWFC3DArenaMark InitialPropagationMark;
+		const FPropagationResult InitialPropagationResult =
+			WFC3DPropagateFunctions::ExecuteInitialPropagation(FWFC3DPropagationContext(Grid, ModelData, FIntVector::ZeroValue));
+		if (InitialPropagationResult.bSuccess)
+		{
+			FWFC3DGridStateCache::StoreInitialState(Grid);
+		}
+	}
+
+	// 영역 분할 병렬 솔버를 사용하면 남은 셀을 모두 붕괴시키므로 아래 단일 스레드 루프는 실행되지 않음
+	if (RegionSolverSettings.bEnabled)
+	{
+		FWFC3DRegionSolver RegionSolver(Grid, ModelData, RegionSolverSettings, RandomStream.RandHelper(MAX_int32));
+		if (!RegionSolver.Solve())
+		{
+			Result.bSuccess = false;
+			bIsRunning = false;
+			bIsRunningAtomic = false;
+			return Result;
+		}
+	}
 
 	// // UE_LOG(LogTemp, Display, TEXT("======================AFTER INIT PROPAGATION=========================="));
 	// Grid->PrintGridInfo();
 	// // UE_LOG(LogTemp, Display, TEXT("======================AFTER INIT PROPAGATION END=========================="));
 
+	// 셀 수에 비례하는 단계 임시 목록(셀 인덱스 목록, 전파 큐)이 커지는 동안 블록을 추가하지 않도록 미리 확보
+	// (배열이 커질 때 이전 공간은 단계가 끝날 때 회수되므로 최종 크기의 두 배)
+	SolverArena.Reserve(static_cast<int64>(Grid->Num()) * sizeof(int32) * 2);
+
+	// 지지 수 배열이 너무 크면 (셀 수 * 6 * 타일 수) 이번 실행은 같은 결과를 내는 Fixpoint 전파 사용
+	FPropagationStrategy StepPropagationStrategy = PropagationStrategy;
+	if (StepPropagationStrategy.PropagationMethod == EPropagationMethod::SupportCounting && !Grid->CanAllocateSupportCounts())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Support Counting needs %lld Bytes of support counts (Max: %lld) - falling back to Fixpoint propagation"),
+		       Grid->GetSupportCountsBytes(), UWFC3DGrid::MaxSupportCountsBytes);
+		StepPropagationStrategy.PropagationMethod = EPropagationMethod::Fixpoint;
+	}
+
+	// 첫 단계 이후 Arena 블록 할당 횟수 (Arena 블록만 세며, Grid의 도메인 페이지 / 공유 도메인 테이블 / Entropy 버킷 등 Arena 밖 할당은 포함하지 않음)
+	int64 SteadyStateBlockAllocationCount = INDEX_NONE;
+
 	while (Grid->GetRemainingCells() > 0 && bIsRunningAtomic.load() && !bIsCancelledAtomic.load())
 	{
+		// 단계가 끝나면 이번 단계의 임시 데이터를 모두 되돌림
+		FWFC3DArenaMark StepMark;
+		if (CurrentStep == 1)
+		{
+			SteadyStateBlockAllocationCount = SolverArena.GetBlockAllocationCount();
+		}
 		// // UE_LOG(LogTemp, Display, TEXT("🔄 Left Step: %d, Total Steps: %d"), Grid->GetRemainingCells(), TotalStepsAtomic.load());
 
 		// 취소 요청이 있으면 루프 중단
@@ -280,7 +336,7 @@ FWFC3DAlgorithmResult UWFC3DAlgorithm::ExecuteInternal(const FWFC3DAlgorithmCont
 		// Propagation 실행
 		// // UE_LOG(LogTemp, Display, TEXT("======================BEFORE PROPAGATION=========================="));
 
-		FPropagationResult PropagationResult = WFC3DPropagateFunctions::ExecutePropagation(PropagationContext, PropagationStrategy);
+		FPropagationResult PropagationResult = WFC3DPropagateFunctions::ExecutePropagation(PropagationContext, StepPropagationStrategy);
 
 		// // UE_LOG(LogTemp, Display, TEXT("======================AFTER PROPAGATION=========================="));
 
@@ -340,8 +396,17 @@ FWFC3DAlgorithmResult UWFC3DAlgorithm::ExecuteInternal(const FWFC3DAlgorithmCont
 		}
 	}
 
+	// 첫 단계 이후 블록 할당은 미리 확보한 공간보다 큰 단계 임시 데이터(큰 AC-4 제거 연쇄, ParallelFixpoint Frontier 도메인 등)가 있었다는 뜻
+	UE_LOG(LogTemp, Log, TEXT("Solver Arena - Allocations: %lld, Block Allocations: %lld (After First Step: %lld), Reserved: %lld Bytes"),
+	       SolverArena.GetAllocationCount(), SolverArena.GetBlockAllocationCount(),
+	       SteadyStateBlockAllocationCount == INDEX_NONE ? 0 : SolverArena.GetBlockAllocationCount() - SteadyStateBlockAllocationCount,
+	       SolverArena.GetReservedBytes());
+	UE_LOG(LogTemp, Log, TEXT("Shared Domains: %d, Memoized Intersections: %d"),
+	       Grid->GetDomainTable().Num(), Grid->GetDomainTable().GetIntersectionsNum());
+
 	// 정상 완료
 	Result.bSuccess = true;
+	Result.SolvedTiles = Grid->GetSolvedTiles();
 	bIsComplete = true;
 	bIsRunning = false;
 	bIsCompleteAtomic = true;
@@ -2,7 +2,8 @@
 #include "WFC/Algorithm/WFC3DFunctionMaps.h"
 #include "WFC/Data/WFC3DGrid.h"
 #include "WFC/Data/WFC3DModelDataAsset.h"
-#include "WFC/Utility/WFC3DHelperFunctions.h"
+#include "WFC/Utility/WFC3DArena.h"
+#include "WFC/Utility/WFC3DWeightedSampler.h"
 
 namespace WFC3DCollapseFunctions
 {
@@ -48,19 +49,16 @@ namespace WFC3DCollapseFunctions
 			return Result;
 		}
 
-		TArray<FWFC3DCell>* GridCells = Grid->GetAllCells();
-
 		// Cell 선택
 		int32 SelectedCellIndex = SelectCellFuncPtr(Context);
-		if (!GridCells->IsValidIndex(SelectedCellIndex))
+		if (!Grid->IsValidLocation(SelectedCellIndex))
 		{
 			UE_LOG(LogTemp, Error, TEXT("Failed to select a cell"));
 			return Result;
 		}
 
-		FWFC3DCell* SelectedCell = &(*GridCells)[SelectedCellIndex];
 		Result.CollapsedIndex = SelectedCellIndex;
-		Result.CollapsedLocation = SelectedCell->Location;
+		Result.CollapsedLocation = Grid->GetCellLocation(SelectedCellIndex);
 
 		// 선택된 Cell의 TileInfoIndex 선택
 		const int32 SelectedTileInfoIndex = SelectTileInfoIndexFuncPtr(Context, SelectedCellIndex);
@@ -78,7 +76,7 @@ namespace WFC3DCollapseFunctions
 		}
 
 		// 선택된 Cell Collapse
-		if (!CollapseSingleCellFuncPtr(SelectedCell, SelectedTileInfoIndex, SelectedTileInfo))
+		if (!CollapseSingleCellFuncPtr(Grid, SelectedCellIndex, SelectedTileInfoIndex, SelectedTileInfo))
 		{
 			UE_LOG(LogTemp, Error, TEXT("Failed to collapse cell"));
 			return Result;
@@ -101,48 +99,56 @@ namespace WFC3DCollapseFunctions
 				return INDEX_NONE;
 			}
 
-			TArray<FWFC3DCell>* GridCells = Grid->GetAllCells();
-			int32 GridCellsSize = GridCells->Num();
-
-			int32 LowestEntropy = INT32_MAX;
-			TArray<int32> CellIndicesWithLowestEntropy;
+			/** Find Lowest Entropy (Grid가 유지하는 Entropy 버킷의 최소 버킷) */
+			FWFC3DEntropyBuckets& EntropyBuckets = Grid->GetEntropyBuckets();
+			const int32 LowestEntropy = EntropyBuckets.FindMinEntropy();
+			if (LowestEntropy == INDEX_NONE)
+			{
+				UE_LOG(LogTemp, Error, TEXT("No Valid Cells In Cell Selector"));
+				return INDEX_NONE;
+			}
 
-			/** Find Lowest Entropy */
-			for (int32 i = 0; i < GridCellsSize; ++i)
+			const TConstArrayView<int32> CellIndicesWithLowestEntropy = EntropyBuckets.GetBucket(LowestEntropy);
+			if (LowestEntropy == 0)
 			{
-				if ((*GridCells)[i].Entropy < LowestEntropy && !(*GridCells)[i].bIsCollapsed)
-				{
-					LowestEntropy = (*GridCells)[i].Entropy;
-					CellIndicesWithLowestEntropy.Empty();
-					CellIndicesWithLowestEntropy.Add(i);
-				}
-				else if ((*GridCells)[i].Entropy == LowestEntropy && !(*GridCells)[i].bIsCollapsed)
+				for (const int32 CellIndex : CellIndicesWithLowestEntropy)
 				{
-					CellIndicesWithLowestEntropy.Add(i);
+					UE_LOG(LogTemp, Display, TEXT("Collapse Grid Failed With Lowest Entropy = 0, Index %d"), CellIndex);
 				}
+				return INDEX_NONE;
 			}
 
-			if (LowestEntropy == INT32_MAX)
+			/** Select Cell From Lowest Entropies */
+			int32 SelectedIndexInLowestEntropy = RandomStream->RandRange(0, CellIndicesWithLowestEntropy.Num() - 1);
+			return CellIndicesWithLowestEntropy[SelectedIndexInLowestEntropy];
+		}
+
+		IMPLEMENT_COLLAPSER_CELL_SELECTOR_STRATEGY(ByShannonEntropy)
+		{
+			UWFC3DGrid* Grid = Context.Grid;
+			const FRandomStream* RandomStream = Context.RandomStream;
+			if (Grid == nullptr)
 			{
-				UE_LOG(LogTemp, Error, TEXT("No Valid Cells In Cell Selector"));
+				UE_LOG(LogTemp, Error, TEXT("Invalid Grid"));
 				return INDEX_NONE;
 			}
 
-			if (LowestEntropy == 0)
+			/** Find Lowest Shannon Entropy (셀 별 가중치 합으로 유지되는 버킷의 최소 버킷) */
+			FWFC3DEntropyBuckets& ShannonEntropyBuckets = Grid->GetShannonEntropyBuckets();
+			const int32 LowestEntropyKey = ShannonEntropyBuckets.FindMinEntropy();
+			if (LowestEntropyKey == INDEX_NONE)
 			{
-				for (int32 i = 0; i < GridCellsSize; ++i)
-				{
-					if ((*GridCells)[i].Entropy == LowestEntropy && !(*GridCells)[i].bIsCollapsed)
-					{
-						UE_LOG(LogTemp, Display, TEXT("Collapse Grid Failed With Lowest Entropy = 0, Index %d"), i);
-					}
-				}
+				UE_LOG(LogTemp, Error, TEXT("No Valid Cells In Cell Selector"));
 				return INDEX_NONE;
 			}
 
-			if (CellIndicesWithLowestEntropy.Num() == 0)
+			const TConstArrayView<int32> CellIndicesWithLowestEntropy = ShannonEntropyBuckets.GetBucket(LowestEntropyKey);
+			if (LowestEntropyKey == 0)
 			{
-				UE_LOG(LogTemp, Error, TEXT("No Valid Cells With Lowest Entropy In Cell Selector"));
+				for (const int32 CellIndex : CellIndicesWithLowestEntropy)
+				{
+					UE_LOG(LogTemp, Display, TEXT("Collapse Grid Failed With No Tile Options Left, Index %d"), CellIndex);
+				}
 				return INDEX_NONE;
 			}
 
@@ -161,14 +167,13 @@ namespace WFC3DCollapseFunctions
 				return INDEX_NONE;
 			}
 
-			TArray<FWFC3DCell>* GridCells = Grid->GetAllCells();
-			int32 GridCellsSize = GridCells->Num();
+			int32 GridCellsSize = Grid->Num();
 
 			/** Find UnCollapsed Cell */
-			TArray<int32> UnCollapsedCellIndices;
+			TArray<int32, TWFC3DArenaAllocator> UnCollapsedCellIndices;
 			for (int32 i = 0; i < GridCellsSize; ++i)
 			{
-				if (!(*GridCells)[i].bIsCollapsed)
+				if (!Grid->IsCollapsed(i))
 				{
 					UnCollapsedCellIndices.Add(i);
 				}
@@ -205,38 +210,30 @@ namespace WFC3DCollapseFunctions
 				return INDEX_NONE;
 			}
 
-			TArray<FWFC3DCell>* GridCells = Grid->GetAllCells();
-			if (!GridCells->IsValidIndex(SelectedCellIndex))
+			if (!Grid->IsValidLocation(SelectedCellIndex))
 			{
 				UE_LOG(LogTemp, Error, TEXT("Invalid Cell Index"));
 				return INDEX_NONE;
 			}
 
-			// UE_LOG(LogTemp, Display, TEXT("RemainingTileOptionBitset : %s"), *FBitString::ToString((*GridCells)[SelectedCellIndex].RemainingTileOptionsBitset));
+			// UE_LOG(LogTemp, Display, TEXT("RemainingTileOptionBitset : %s"), *FWFC3DDomainUtils::ToString(Grid->GetTileOptions(SelectedCellIndex), Grid->GetTileInfosNum()));
 
-			/** Get Enalbe TileInfos */
-			TArray<int32> TileInfoIndices = FWFC3DHelperFunctions::GetAllIndexFromBitset((*GridCells)[SelectedCellIndex].RemainingTileOptionsBitset);
-			if (TileInfoIndices.Num() == 0)
+			/** Select By Weights (모든 타일이 남은 셀은 Alias 테이블, 그 외에는 도메인 워드를 직접 순회) */
+			int32 SelectedTileInfoIndex;
+			if (Grid->GetEntropy(SelectedCellIndex) == Grid->GetTileInfosNum() && !ModelData->GetTileAliasProbabilities().IsEmpty())
 			{
-				UE_LOG(LogTemp, Error, TEXT("No Valid TileInfo Indices"));
-				return INDEX_NONE;
+				SelectedTileInfoIndex = FWFC3DWeightedSampler::SampleAlias(ModelData->GetTileAliasProbabilities(), ModelData->GetTileAliasIndices(), *RandomStream);
 			}
-			
-			// for (int32 Index : TileInfoIndices)
-			// {
-			// 	UE_LOG(LogTemp, Display, TEXT("TileInfoIndex: %d"), Index);
-			// }
-
-
-			/** Get Weights */
-			TArray<float> Weights;
-			for (int32 Index : TileInfoIndices)
+			else
 			{
-				Weights.Add(ModelData->GetTileInfo(Index)->Weight);
+				SelectedTileInfoIndex = FWFC3DWeightedSampler::SampleDomain(static_cast<const UWFC3DGrid*>(Grid)->GetTileOptions(SelectedCellIndex),
+				                                                            Grid->GetTileWordsNum(), ModelData->GetTileSampleWeights(), *RandomStream);
+			}
+			if (SelectedTileInfoIndex == INDEX_NONE)
+			{
+				UE_LOG(LogTemp, Error, TEXT("No Valid TileInfo Indices"));
+				return INDEX_NONE;
 			}
-
-			/** Select By Weights */
-			int32 SelectedTileInfoIndex = TileInfoIndices[FWFC3DHelperFunctions::GetWeightedRandomIndex(Weights, RandomStream)];
 			return SelectedTileInfoIndex;
 		}
 
@@ -251,26 +248,33 @@ namespace WFC3DCollapseFunctions
 				return INDEX_NONE;
 			}
 
-			TArray<FWFC3DCell>* GridCells = Grid->GetAllCells();
-			if (!GridCells->IsValidIndex(SelectedCellIndex))
+			if (!Grid->IsValidLocation(SelectedCellIndex))
 			{
 				UE_LOG(LogTemp, Error, TEXT("Invalid Cell Index"));
 				return INDEX_NONE;
 			}
 
-			// UE_LOG(LogTemp, Display, TEXT("RemainingTileOptionBitset : %s"), *FBitString::ToString((*GridCells)[SelectedCellIndex].RemainingTileOptionsBitset));
+			// UE_LOG(LogTemp, Display, TEXT("RemainingTileOptionBitset : %s"), *FWFC3DDomainUtils::ToString(Grid->GetTileOptions(SelectedCellIndex), Grid->GetTileInfosNum()));
 
-			/** Get Enalbe TileInfos */
-			TArray<int32> TileInfoIndices = FWFC3DHelperFunctions::GetAllIndexFromBitset((*GridCells)[SelectedCellIndex].RemainingTileOptionsBitset);
-			if (TileInfoIndices.Num() == 0)
+			/** Select Randomly (남은 타일 옵션 중 RandomIndex 번째 타일) */
+			const int32 TileOptionsNum = Grid->GetEntropy(SelectedCellIndex);
+			if (TileOptionsNum <= 0)
 			{
 				UE_LOG(LogTemp, Error, TEXT("No Valid TileInfo Indices"));
 				return INDEX_NONE;
 			}
 
-			/** Select Randomly */
-			int32 RandomIndex = RandomStream->RandRange(0, TileInfoIndices.Num() - 1);
-			return TileInfoIndices[RandomIndex];
+			int32 RandomIndex = RandomStream->RandRange(0, TileOptionsNum - 1);
+			for (const int32 TileInfoIndex : FWFC3DDomainUtils::GetSetBits(static_cast<const UWFC3DGrid*>(Grid)->GetTileOptions(SelectedCellIndex), Grid->GetTileWordsNum()))
+			{
+				if (RandomIndex-- == 0)
+				{
+					return TileInfoIndex;
+				}
+			}
+
+			UE_LOG(LogTemp, Error, TEXT("Entropy does not match TileOptions at Index %d"), SelectedCellIndex);
+			return INDEX_NONE;
 		}
 
 		IMPLEMENT_COLLAPSER_TILE_INFO_INDEX_SELECTOR_STRATEGY(Custom)
@@ -284,7 +288,7 @@ namespace WFC3DCollapseFunctions
 	{
 		IMPLEMENT_COLLAPSER_CELL_COLLAPSER_STRATEGY(Default)
 		{
-			if (SelectedCell == nullptr)
+			if (Grid == nullptr || !Grid->IsValidLocation(SelectedCellIndex))
 			{
 				UE_LOG(LogTemp, Error, TEXT("Invalid Cell"));
 				return false;
@@ -294,37 +298,21 @@ namespace WFC3DCollapseFunctions
 				UE_LOG(LogTemp, Error, TEXT("Invalid TileInfo"));
 				return false;
 			}
-			if (SelectedCell->bIsCollapsed)
+			if (Grid->IsCollapsed(SelectedCellIndex))
 			{
 				UE_LOG(LogTemp, Error, TEXT("Cell is already collapsed"));
 				return false;
 			}
 
-			SelectedCell->CollapsedTileInfo = SelectedTileInfo;
-			SelectedCell->CollapsedTileInfoIndex = SelectedTileInfoIndex;
-			SelectedCell->Entropy = 1;
-			SelectedCell->bIsCollapsed = true;
-			SelectedCell->RemainingTileOptionsBitset.Init(false, SelectedCell->RemainingTileOptionsBitset.Num());
-			SelectedCell->RemainingTileOptionsBitset[SelectedTileInfoIndex] = true;
+			Grid->CollapseCell(SelectedCellIndex, SelectedTileInfoIndex);
 
-			const TArray<int32>& FacesIndices = SelectedTileInfo->Faces;
-			for (const EFace& Direction : FWFC3DFaceUtils::AllDirections)
-			{
-				uint8 DirectionIndex = FWFC3DFaceUtils::GetIndex(Direction);
-				SelectedCell->MergedFaceOptionsBitset[DirectionIndex].Init(false, SelectedCell->MergedFaceOptionsBitset[DirectionIndex].Num());
-				SelectedCell->MergedFaceOptionsBitset[DirectionIndex][FacesIndices[DirectionIndex]] = true;
-			}
-
-			// UE_LOG(LogTemp, Display, TEXT("Collapse Cell at Location: %s"), *SelectedCell->Location.ToString());
+			// UE_LOG(LogTemp, Display, TEXT("Collapse Cell at Location: %s"), *Grid->GetCellLocation(SelectedCellIndex).ToString());
 			// UE_LOG(LogTemp, Display, TEXT("SelectedTileInfoIndex %d"), SelectedTileInfoIndex);
 			// UE_LOG(LogTemp, Display, TEXT("Cell Collapser: U: %d, B: %d, R: %d, L: %d, F: %d, D: %d"),
 			       // SelectedTileInfo->Faces[0], SelectedTileInfo->Faces[1], SelectedTileInfo->Faces[2],
 			       // SelectedTileInfo->Faces[3], SelectedTileInfo->Faces[4], SelectedTileInfo->Faces[5]
 			// );
 
-			SelectedCell->bIsCollapsed = true;
-			SelectedCell->bIsPropagated = true;
-
 			return true;
 		}
 
@@ -4,10 +4,558 @@
 #include "WFC/Algorithm/WFC3DPropagation.h"
 
 #include "WFC/Algorithm/WFC3DFunctionMaps.h"
+#include "WFC/Data/WFC3DDomainTable.h"
 #include "WFC/Data/WFC3DFaceUtils.h"
 #include "WFC/Data/WFC3DGrid.h"
 #include "WFC/Data/WFC3DModelDataAsset.h"
-#include "WFC/Utility/WFC3DHelperFunctions.h"
+#include "WFC/Utility/WFC3DDomain.h"
+#include "WFC/Utility/WFC3DDomainUtils.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/**
+	 * 이웃 셀의 남은 타일 옵션이 Direction 방향(이웃 -> 셀)으로 허용하는 타일 집합을 계산합니다.
+	 * 이웃 타일 수보다 해당 방향 면 클래스 수가 적으면 면 클래스 단위로, 아니면 타일 단위로 Compatible 마스크를 OR 합니다.
+	 */
+	template <int32 NumWords>
+	void GatherSupportedTiles(const uint64* NeighbourTileOptions, const int32 NeighbourEntropy, const EFace Direction,
+	                          uint64* OutSupportedTiles, const int32 TileWordsNum, const UWFC3DModelDataAsset* ModelData)
+	{
+		using FDomain = TWFCDomain<NumWords>;
+		FDomain::Clear(OutSupportedTiles, TileWordsNum);
+
+		const TArray<int32>& FaceIndices = ModelData->GetDirectionFaceIndices(Direction);
+		if (FaceIndices.Num() < NeighbourEntropy)
+		{
+			// 같은 면을 가진 타일은 같은 타일을 허용하므로 이웃에 남은 면 클래스만 OR
+			for (const int32 FaceIndex : FaceIndices)
+			{
+				if (FDomain::Intersects(NeighbourTileOptions, ModelData->GetFaceClassTileWords(FaceIndex), TileWordsNum))
+				{
+					FDomain::Or(OutSupportedTiles, ModelData->GetCompatibleTileWords(FaceIndex), TileWordsNum);
+				}
+			}
+			return;
+		}
+
+		for (const int32 TileIndex : FDomain::GetSetBits(NeighbourTileOptions, TileWordsNum))
+		{
+			FDomain::Or(OutSupportedTiles, ModelData->GetTileCompatibleWords(TileIndex, Direction), TileWordsNum);
+		}
+	}
+
+	/**
+	 * 단일 Cell 전파 커널
+	 * NumWords 워드의 고정 크기 TWFCDomain으로 인스턴스화되며, NumWords가 0이면 런타임 크기 도메인을 사용합니다.
+	 * 공유 도메인을 가진 셀은 공유 도메인 테이블의 교집합 기록 (DomainA, MaskB) -> DomainC를 따라가며,
+	 * 기록이 없을 때만 And 연산 후 결과를 테이블에 등록합니다. 테이블이 가득 차면 셀이 자신의 도메인을 가집니다.
+	 * bFixpoint이면 6방향 모두에서 교집합을 계산하고, 도메인이 줄어들면 전파 여부와 무관하게 모든 이웃을 다시 대기시킵니다.
+	 */
+	template <int32 NumWords, bool bFixpoint>
+	bool PropagateCellWithDomain(const int32 PropagatedCellIndex, UWFC3DGrid* Grid, FWFC3DCellWorklist& PropagationQueue,
+	                             const UWFC3DModelDataAsset* ModelData)
+	{
+		if (Grid == nullptr || ModelData == nullptr || !Grid->IsValidLocation(PropagatedCellIndex))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Invalid PropagatedCell or Grid or ModelData"));
+			return false;
+		}
+
+		if (Grid->IsCollapsed(PropagatedCellIndex) || (!bFixpoint && Grid->IsPropagated(PropagatedCellIndex)))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Cell already collapsed or propagated at Location: %s"), *Grid->GetCellLocation(PropagatedCellIndex).ToString());
+			return false;
+		}
+
+		// 읽기는 const 접근 (스냅샷과 공유 중인 페이지나 공유 도메인을 복사하지 않음)
+		const UWFC3DGrid* ConstGrid = Grid;
+		const int32 TileWordsNum = Grid->GetTileWordsNum();
+
+		using FDomain = TWFCDomain<NumWords>;
+
+		// 셀이 참조하는 공유 도메인 (INDEX_NONE이면 RemainingTileOptions가 셀의 현재 도메인)
+		const int32 InitialSharedDomainId = Grid->GetSharedDomainId(PropagatedCellIndex);
+		int32 SharedDomainId = InitialSharedDomainId;
+
+		// 남은 타일 옵션 작업 사본 (고정 크기 도메인이면 스택에 위치)
+		FDomain RemainingTileOptions(TileWordsNum);
+		FDomain::Copy(RemainingTileOptions.GetData(), ConstGrid->GetTileOptions(PropagatedCellIndex), TileWordsNum);
+
+		// RemainingTileOptions의 타일 옵션 수 (And 연산 결과와 함께 갱신되므로 마지막에 다시 세지 않음)
+		int32 RemainingTileOptionsCount = Grid->GetEntropy(PropagatedCellIndex);
+
+		// 방향 별 이웃이 허용하는 타일 옵션
+		FDomain SupportedTileOptions(TileWordsNum);
+
+		// 전파 받은 면에 대해서 남은 타일 옵션을 가져와서 병합 -> 남은 타일 몹션에 대해서 전파 받지 않은 방향으로 전파
+		// 전파 받은 면에 대하여 전파 받은 면의 타일 옵션을 병합
+		for (const EFace Direction : FWFC3DFaceUtils::AllDirections)
+		{
+			const int32 NextCellIndex = Grid->GetNeighbourIndex(PropagatedCellIndex, Direction);
+			// Grid 밖 방향은 초기 전파의 외곽 패스에서 경계 타일 마스크가 이미 적용됨
+			// 전파 받은 면이 아닌 경우에는 건너뜀
+			if (NextCellIndex == INDEX_NONE || (!bFixpoint && !Grid->IsFacePropagated(PropagatedCellIndex, Direction)))
+			{
+				continue;
+			}
+
+			// 이 방향에서 허용되는 타일 마스크와 교집합 기록용 키
+			const uint64* TileMask = nullptr;
+			uint32 MaskKey = FWFC3DDomainTable::InvalidMaskKey;
+			int32 NextSharedDomainId = INDEX_NONE;
+
+			if (Grid->GetCollapsedTileIndex(NextCellIndex) != UWFC3DGrid::InvalidTileIndex)
+			{
+				// 붕괴된 이웃 (Halo 셀 포함)은 도메인 없이 타일 인덱스만 가지므로, 해당 타일의 Compatible 마스크를 바로 사용
+				const uint16 NextTileIndex = Grid->GetCollapsedTileIndex(NextCellIndex);
+				const FTileInfo* NextTileInfo = ModelData->GetTileInfo(NextTileIndex);
+				if (NextTileInfo == nullptr)
+				{
+					return false;
+				}
+				TileMask = ModelData->GetTileCompatibleWords(NextTileIndex, FWFC3DFaceUtils::GetOpposite(Direction));
+				MaskKey = FWFC3DDomainTable::MakeFaceMaskKey(NextTileInfo->Faces[FWFC3DFaceUtils::GetOppositeIndex(Direction)]);
+			}
+			else
+			{
+				// 공유 도메인을 가진 이웃의 마스크는 이웃 도메인 id로 결정됨
+				NextSharedDomainId = Grid->GetSharedDomainId(NextCellIndex);
+				if (NextSharedDomainId != INDEX_NONE)
+				{
+					MaskKey = FWFC3DDomainTable::MakeDomainMaskKey(NextSharedDomainId, Direction);
+				}
+			}
+
+			// 기록된 교집합이 있으면 And 연산 없이 결과 도메인으로 이동
+			if (SharedDomainId != INDEX_NONE && MaskKey != FWFC3DDomainTable::InvalidMaskKey)
+			{
+				const int32 IntersectionId = ConstGrid->GetDomainTable().FindIntersection(SharedDomainId, MaskKey);
+				if (IntersectionId != INDEX_NONE)
+				{
+					SharedDomainId = IntersectionId;
+					continue;
+				}
+			}
+
+			if (TileMask == nullptr)
+			{
+				// 전파 받은 면에 대해서 이웃의 남은 타일들이 허용하는 타일 옵션을 OR로 병합
+				GatherSupportedTiles<NumWords>(ConstGrid->GetTileOptions(NextCellIndex), Grid->GetEntropy(NextCellIndex),
+				                               FWFC3DFaceUtils::GetOpposite(Direction), SupportedTileOptions.GetData(), TileWordsNum, ModelData);
+				TileMask = SupportedTileOptions.GetData();
+			}
+
+			if (SharedDomainId == INDEX_NONE)
+			{
+				// 전파 받은 면의 타일 옵션을 RemainingTileOptions와 And 연산
+				RemainingTileOptionsCount = FDomain::AndWithChange(RemainingTileOptions.GetData(), TileMask, TileWordsNum).SetBitsNum;
+				if (RemainingTileOptionsCount == 0)
+				{
+					break;
+				}
+				continue;
+			}
+
+			// 공유 도메인과의 교집합을 계산하여 등록
+			const int32 SourceDomainId = SharedDomainId;
+			FDomain::Copy(RemainingTileOptions.GetData(), ConstGrid->GetDomainTable().GetEntry(SourceDomainId), TileWordsNum);
+			RemainingTileOptionsCount = FDomain::AndWithChange(RemainingTileOptions.GetData(), TileMask, TileWordsNum).SetBitsNum;
+
+			// 타일 옵션이 모두 사라진 도메인은 등록하지 않음 (아래에서 전파 실패 처리)
+			if (RemainingTileOptionsCount == 0)
+			{
+				SharedDomainId = INDEX_NONE;
+				break;
+			}
+
+			FWFC3DDomainTable& DomainTable = Grid->GetMutableDomainTable();
+			SharedDomainId = DomainTable.Intern(RemainingTileOptions.GetData());
+			if (SharedDomainId != INDEX_NONE && MaskKey != FWFC3DDomainTable::InvalidMaskKey)
+			{
+				DomainTable.AddIntersection(SourceDomainId, MaskKey, SharedDomainId);
+			}
+		}
+
+		// 공유 도메인으로 남은 경우: 도메인 id만 바꾸면 되므로 셀 도메인을 쓰지 않음
+		if (SharedDomainId != INDEX_NONE)
+		{
+			// 전파 받은 타일 옵션이 이전과 같다면 전파하지 않음
+			if (SharedDomainId == InitialSharedDomainId)
+			{
+				return true;
+			}
+			Grid->SetSharedDomain(PropagatedCellIndex, SharedDomainId);
+		}
+		else
+		{
+			// 전파 받은 타일 옵션의 개수가 이전과 같다면 전파하지 않음
+			if (Grid->GetEntropy(PropagatedCellIndex) == RemainingTileOptionsCount)
+			{
+				return true;
+			}
+
+			// 남은 타일 옵션이 없으면 전파 실패
+			if (RemainingTileOptionsCount == 0)
+			{
+				UE_LOG(LogTemp, Error, TEXT("No valid tile options left at Location: %s"), *Grid->GetCellLocation(PropagatedCellIndex).ToString());
+				// Grid->PrintCellInfo(PropagatedCellIndex);
+				return false;
+			}
+
+			// 셀이 자신의 도메인을 가지도록 하고 (공유 도메인이었으면 페이지로 복사) 결과 기록
+			Grid->NarrowTileOptions(PropagatedCellIndex, RemainingTileOptions.GetData(), RemainingTileOptionsCount);
+		}
+
+		if constexpr (bFixpoint)
+		{
+			// 도메인이 줄어들었으므로 붕괴되지 않은 모든 이웃을 다시 대기 (이미 대기 중이면 무시됨)
+			for (const EFace& Direction : FWFC3DFaceUtils::AllDirections)
+			{
+				const int32 CellIndexToPropagate = Grid->GetNeighbourIndex(PropagatedCellIndex, Direction);
+				if (CellIndexToPropagate != INDEX_NONE && !Grid->IsCollapsed(CellIndexToPropagate))
+				{
+					Grid->SetPropagatedFace(CellIndexToPropagate, FWFC3DFaceUtils::GetOpposite(Direction));
+					PropagationQueue.Enqueue(CellIndexToPropagate);
+				}
+			}
+			return true;
+		}
+
+		for (const EFace& Direction : FWFC3DFaceUtils::AllDirections)
+		{
+			// 전파 받은 면이면 건너뜀
+			if (Grid->IsFacePropagated(PropagatedCellIndex, Direction))
+			{
+				continue;
+			}
+
+			// 전파 받지 않은 면에 대해서는 해당 방향으로 전파하기
+			const int32 CellIndexToPropagate = Grid->GetNeighbourIndex(PropagatedCellIndex, Direction);
+			if (CellIndexToPropagate == INDEX_NONE || Grid->IsCollapsed(CellIndexToPropagate) || Grid->IsPropagated(CellIndexToPropagate))
+			{
+				continue;
+			}
+
+			// 전파 받을 Cell에 대해서는 반대 방향에서 온 것 이므로 반대 방향에서 전파 받았다고 설정
+			Grid->SetPropagatedFace(CellIndexToPropagate, FWFC3DFaceUtils::GetOpposite(Direction));
+			PropagationQueue.Enqueue(CellIndexToPropagate);
+		}
+
+		// 전파 성공
+		return true;
+	}
+
+	using FPropagateCellFuncPtr = bool(*)(const int32, UWFC3DGrid*, FWFC3DCellWorklist&, const UWFC3DModelDataAsset*);
+
+	/**
+	 * Tile 워드 수에 맞는 고정 크기 전파 커널을 선택합니다.
+	 * Grid / ModelData의 워드 수는 GetAlignedWordsNum으로 정렬되어 있으므로 1, 2, 4, 8, 16 워드는 고정 크기 경로를 사용합니다.
+	 */
+	FPropagateCellFuncPtr GetPropagateCellFunction(const int32 TileWordsNum, const bool bFixpoint = false)
+	{
+		return WFC3DDispatchDomainWords(TileWordsNum, [bFixpoint](auto WordsTag) -> FPropagateCellFuncPtr
+		{
+			return bFixpoint
+				       ? &PropagateCellWithDomain<decltype(WordsTag)::Value, true>
+				       : &PropagateCellWithDomain<decltype(WordsTag)::Value, false>;
+		});
+	}
+
+	/**
+	 * 셀의 현재 도메인과 6방향 이웃이 허용하는 타일의 교집합을 계산합니다.
+	 * Grid와 ModelData를 읽기만 하므로 Grid에 쓰는 작업이 없는 동안 여러 스레드에서 동시에 호출할 수 있습니다.
+	 * @return 교집합의 타일 옵션 수
+	 */
+	template <int32 NumWords>
+	int32 IntersectNeighbourSupports(const int32 CellIndex, const UWFC3DGrid* Grid, const UWFC3DModelDataAsset* ModelData, uint64* OutTileOptions)
+	{
+		using FDomain = TWFCDomain<NumWords>;
+		const int32 TileWordsNum = Grid->GetTileWordsNum();
+		FDomain::Copy(OutTileOptions, Grid->GetTileOptions(CellIndex), TileWordsNum);
+
+		FDomain SupportedTileOptions(TileWordsNum);
+		int32 TileOptionsCount = Grid->GetEntropy(CellIndex);
+		for (const EFace Direction : FWFC3DFaceUtils::AllDirections)
+		{
+			const int32 NextCellIndex = Grid->GetNeighbourIndex(CellIndex, Direction);
+			const uint64* TileMask;
+			if (NextCellIndex == INDEX_NONE)
+			{
+				// 경계 타일 마스크는 초기 전파에서 이미 적용됨
+				continue;
+			}
+			if (Grid->GetCollapsedTileIndex(NextCellIndex) != UWFC3DGrid::InvalidTileIndex)
+			{
+				TileMask = ModelData->GetTileCompatibleWords(Grid->GetCollapsedTileIndex(NextCellIndex), FWFC3DFaceUtils::GetOpposite(Direction));
+			}
+			else
+			{
+				GatherSupportedTiles<NumWords>(Grid->GetTileOptions(NextCellIndex), Grid->GetEntropy(NextCellIndex),
+				                               FWFC3DFaceUtils::GetOpposite(Direction), SupportedTileOptions.GetData(), TileWordsNum, ModelData);
+				TileMask = SupportedTileOptions.GetData();
+			}
+			TileOptionsCount = FDomain::AndWithChange(OutTileOptions, TileMask, TileWordsNum).SetBitsNum;
+		}
+		return TileOptionsCount;
+	}
+
+	/** 경계 타일 마스크 적용으로 도메인이 줄어든 외곽 셀의 이웃을 전파 대기 목록에 추가합니다. */
+	void EnqueueShellNeighbours(const int32 CellIndex, UWFC3DGrid* Grid, FWFC3DCellWorklist& PropagationQueue)
+	{
+		for (const EFace& Direction : FWFC3DFaceUtils::AllDirections)
+		{
+			const int32 NextCellIndex = Grid->GetNeighbourIndex(CellIndex, Direction);
+			if (NextCellIndex == INDEX_NONE || !Grid->IsGridCell(NextCellIndex) || Grid->IsCollapsed(NextCellIndex))
+			{
+				continue;
+			}
+			Grid->SetPropagatedFace(NextCellIndex, FWFC3DFaceUtils::GetOpposite(Direction));
+			PropagationQueue.Enqueue(NextCellIndex);
+		}
+	}
+
+	/**
+	 * Grid 외곽 셀에 방향 별 경계 타일 마스크를 한 번에 적용합니다. (초기 전파 시작 시 한 번)
+	 * 초기 공유 도메인을 가진 셀은 경계 방향 조합 별로 교집합을 한 번만 계산하여 공유 도메인으로 등록하므로,
+	 * 같은 면의 셀은 모두 같은 도메인 id를 가집니다.
+	 * @return 경계 조건을 만족하는 타일이 없는 셀이 있으면 false
+	 */
+	bool ApplyBoundaryShell(UWFC3DGrid* Grid, FWFC3DCellWorklist& PropagationQueue)
+	{
+		const TConstArrayView<int32> ShellCells = Grid->GetBoundaryShellCells();
+		const TConstArrayView<uint8> ShellFaces = Grid->GetBoundaryShellFaces();
+		const int32 TileWordsNum = Grid->GetTileWordsNum();
+
+		// 경계 방향 조합(6비트) 별 초기 도메인과 경계 마스크의 교집합 도메인 id
+		int32 ShellDomainIds[1 << 6];
+		for (int32& ShellDomainId : ShellDomainIds)
+		{
+			ShellDomainId = INDEX_NONE;
+		}
+		TArray<uint64, TWFC3DArenaAllocator> ShellTileOptions;
+		ShellTileOptions.SetNumZeroed(TileWordsNum);
+
+		for (int32 ShellIndex = 0; ShellIndex < ShellCells.Num(); ++ShellIndex)
+		{
+			const int32 CellIndex = ShellCells[ShellIndex];
+			const uint8 Faces = ShellFaces[ShellIndex];
+			if (Grid->IsCollapsed(CellIndex))
+			{
+				continue;
+			}
+
+			if (Grid->GetSharedDomainId(CellIndex) == UWFC3DGrid::InitialDomainId)
+			{
+				int32& ShellDomainId = ShellDomainIds[Faces];
+				if (ShellDomainId == INDEX_NONE)
+				{
+					FWFC3DDomainUtils::Copy(ShellTileOptions.GetData(), Grid->GetDomainTable().GetEntry(UWFC3DGrid::InitialDomainId), TileWordsNum);
+					int32 ShellEntropy = Grid->GetEntropy(CellIndex);
+					for (const EFace& Direction : FWFC3DFaceUtils::AllDirections)
+					{
+						if ((Faces & 1 << FWFC3DFaceUtils::GetIndex(Direction)) != 0)
+						{
+							ShellEntropy = FWFC3DDomainUtils::AndIntoWithChange(ShellTileOptions.GetData(), Grid->GetBoundaryTileOptions(Direction), TileWordsNum).SetBitsNum;
+						}
+					}
+					if (ShellEntropy == 0)
+					{
+						UE_LOG(LogTemp, Error, TEXT("No tile satisfies the boundary at Location: %s"), *Grid->GetCellLocation(CellIndex).ToString());
+						return false;
+					}
+					ShellDomainId = Grid->GetMutableDomainTable().Intern(ShellTileOptions.GetData());
+				}
+
+				// 공유 도메인 테이블이 가득 찬 경우에만 아래에서 셀 도메인에 직접 적용
+				if (ShellDomainId != INDEX_NONE)
+				{
+					if (ShellDomainId != UWFC3DGrid::InitialDomainId)
+					{
+						Grid->SetSharedDomain(CellIndex, ShellDomainId);
+						EnqueueShellNeighbours(CellIndex, Grid, PropagationQueue);
+					}
+					continue;
+				}
+			}
+
+			const UWFC3DGrid* ConstGrid = Grid;
+			FWFC3DDomainUtils::Copy(ShellTileOptions.GetData(), ConstGrid->GetTileOptions(CellIndex), TileWordsNum);
+			FWFC3DDomainChange Change;
+			bool bChanged = false;
+			for (const EFace& Direction : FWFC3DFaceUtils::AllDirections)
+			{
+				if ((Faces & 1 << FWFC3DFaceUtils::GetIndex(Direction)) != 0)
+				{
+					Change = FWFC3DDomainUtils::AndIntoWithChange(ShellTileOptions.GetData(), Grid->GetBoundaryTileOptions(Direction), TileWordsNum);
+					bChanged |= Change.bChanged;
+				}
+			}
+			if (!bChanged)
+			{
+				continue;
+			}
+			if (Change.SetBitsNum == 0)
+			{
+				UE_LOG(LogTemp, Error, TEXT("No tile satisfies the boundary at Location: %s"), *Grid->GetCellLocation(CellIndex).ToString());
+				return false;
+			}
+			Grid->NarrowTileOptions(CellIndex, ShellTileOptions.GetData(), Change.SetBitsNum);
+			EnqueueShellNeighbours(CellIndex, Grid, PropagationQueue);
+		}
+		return true;
+	}
+
+	using FIntersectNeighbourSupportsFuncPtr = int32(*)(const int32, const UWFC3DGrid*, const UWFC3DModelDataAsset*, uint64*);
+
+	/** 병렬 전파에서 ParallelFor를 사용하는 최소 Frontier 셀 수 (작은 Frontier는 작업 분배 비용이 더 큼) */
+	constexpr int32 MinParallelFrontierNum = 64;
+
+	/** 병렬 전파 Frontier 셀의 계산 결과 */
+	enum class EFrontierCellResult : uint8
+	{
+		Unchanged,
+		Narrowed,
+		Contradiction,
+	};
+
+	/** AC-4 전파에서 셀에서 제거된 타일 */
+	struct FRemovedTile
+	{
+		int32 CellIndex;
+		int32 TileIndex;
+	};
+
+	/**
+	 * 셀의 Direction 방향 지지 수를 이웃의 현재 상태로 다시 계산합니다.
+	 * Grid 밖이나 붕괴된 이웃은 허용 여부(0 / 1)를, 붕괴되지 않은 이웃은 호환 타일 수를 기록합니다.
+	 * 같은 면을 가진 타일은 지지하는 이웃 타일도 같으므로 호환 타일 수는 면 클래스 당 한 번만 계산합니다.
+	 */
+	void BuildSupportCounts(const int32 CellIndex, const EFace Direction, UWFC3DGrid* Grid, const UWFC3DModelDataAsset* ModelData,
+	                        TArray<uint16, TWFC3DArenaAllocator>& FaceSupportCounts)
+	{
+		const UWFC3DGrid* ConstGrid = Grid;
+		const TArray<FTileInfo>& TileInfos = *ModelData->GetTileInfos();
+		const int32 TileInfosNum = Grid->GetTileInfosNum();
+		uint16* SupportCounts = Grid->GetSupportCounts(CellIndex, Direction);
+
+		const int32 NextCellIndex = Grid->GetNeighbourIndex(CellIndex, Direction);
+		if (NextCellIndex == INDEX_NONE || Grid->GetCollapsedTileIndex(NextCellIndex) != UWFC3DGrid::InvalidTileIndex)
+		{
+			const uint64* AllowedTiles = NextCellIndex == INDEX_NONE
+				                             ? Grid->GetBoundaryTileOptions(Direction)
+				                             : ModelData->GetTileCompatibleWords(Grid->GetCollapsedTileIndex(NextCellIndex), FWFC3DFaceUtils::GetOpposite(Direction));
+			for (int32 TileIndex = 0; TileIndex < TileInfosNum; ++TileIndex)
+			{
+				SupportCounts[TileIndex] = FWFC3DDomainUtils::TestBit(AllowedTiles, TileIndex) ? 1 : 0;
+			}
+			return;
+		}
+
+		const uint64* NextTileOptions = ConstGrid->GetTileOptions(NextCellIndex);
+		for (const int32 FaceIndex : ModelData->GetDirectionFaceIndices(Direction))
+		{
+			FaceSupportCounts[FaceIndex] = static_cast<uint16>(FWFC3DDomainUtils::CountCommonBits(
+				NextTileOptions, ModelData->GetCompatibleTileWords(FaceIndex), Grid->GetTileWordsNum()));
+		}
+
+		const int32 DirectionIndex = FWFC3DFaceUtils::GetIndex(Direction);
+		for (int32 TileIndex = 0; TileIndex < TileInfosNum; ++TileIndex)
+		{
+			SupportCounts[TileIndex] = FaceSupportCounts[TileInfos[TileIndex].Faces[DirectionIndex]];
+		}
+	}
+
+	/**
+	 * 셀에서 타일을 제거하고 제거 큐에 추가합니다.
+	 * @return 셀에 남은 타일 옵션이 있으면 true
+	 */
+	bool RemoveTile(const int32 CellIndex, const int32 TileIndex, UWFC3DGrid* Grid, TWFC3DArenaQueue<FRemovedTile>& RemovedTiles,
+	                FPropagationResult& Result)
+	{
+		// 셀이 자신의 도메인을 가지도록 하고 (공유 도메인이었으면 페이지로 복사) 타일 제거
+		Grid->RemoveTileOption(CellIndex, TileIndex);
+		const int32 RemainingTileOptionsCount = Grid->GetEntropy(CellIndex);
+		RemovedTiles.Enqueue({CellIndex, TileIndex});
+
+		if (!Grid->IsPropagated(CellIndex))
+		{
+			Grid->SetPropagated(CellIndex, true);
+			++Result.AffectedCellCount;
+		}
+
+		if (RemainingTileOptionsCount <= 0)
+		{
+			UE_LOG(LogTemp, Error, TEXT("No valid tile options left at Location: %s"), *Grid->GetCellLocation(CellIndex).ToString());
+			return false;
+		}
+		return true;
+	}
+
+	/**
+	 * Direction 방향 지지 수가 0인 타일을 셀에서 제거합니다.
+	 * @return 셀에 남은 타일 옵션이 있으면 true
+	 */
+	bool RemoveUnsupportedTiles(const int32 CellIndex, const EFace Direction, UWFC3DGrid* Grid,
+	                            TWFC3DArenaQueue<FRemovedTile>& RemovedTiles, FPropagationResult& Result)
+	{
+		const UWFC3DGrid* ConstGrid = Grid;
+		const int32 TileWordsNum = Grid->GetTileWordsNum();
+		const uint16* SupportCounts = Grid->GetSupportCounts(CellIndex, Direction);
+
+		// 타일을 제거하면 셀 도메인이 페이지로 복사될 수 있으므로 매번 현재 도메인에서 다음 타일을 찾음
+		for (int32 TileIndex = FWFC3DDomainUtils::FindFrom(ConstGrid->GetTileOptions(CellIndex), TileWordsNum, 0);
+		     TileIndex != INDEX_NONE;
+		     TileIndex = FWFC3DDomainUtils::FindFrom(ConstGrid->GetTileOptions(CellIndex), TileWordsNum, TileIndex + 1))
+		{
+			if (SupportCounts[TileIndex] == 0 && !RemoveTile(CellIndex, TileIndex, Grid, RemovedTiles, Result))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * 제거된 타일이 지지하던 이웃 타일의 지지 수를 감소시키고, 지지 수가 0이 된 타일을 제거합니다.
+	 * 호환 관계는 대칭이므로 Compatible[RemovedTile][Direction] 중 이웃에 남은 타일만 갱신합니다.
+	 * @return 모든 이웃 셀에 남은 타일 옵션이 있으면 true
+	 */
+	bool PropagateRemovedTile(const FRemovedTile& Removed, UWFC3DGrid* Grid, const UWFC3DModelDataAsset* ModelData,
+	                          TWFC3DArenaQueue<FRemovedTile>& RemovedTiles, FPropagationResult& Result)
+	{
+		const UWFC3DGrid* ConstGrid = Grid;
+		const int32 TileWordsNum = Grid->GetTileWordsNum();
+
+		for (const EFace Direction : FWFC3DFaceUtils::AllDirections)
+		{
+			const int32 NextCellIndex = Grid->GetNeighbourIndex(Removed.CellIndex, Direction);
+			if (NextCellIndex == INDEX_NONE || Grid->IsCollapsed(NextCellIndex))
+			{
+				continue;
+			}
+
+			const uint64* CompatibleTiles = ModelData->GetTileCompatibleWords(Removed.TileIndex, Direction);
+			uint16* SupportCounts = Grid->GetSupportCounts(NextCellIndex, FWFC3DFaceUtils::GetOpposite(Direction));
+
+			for (int32 WordIndex = 0; WordIndex < TileWordsNum; ++WordIndex)
+			{
+				uint64 AffectedTiles = CompatibleTiles[WordIndex] & ConstGrid->GetTileOptions(NextCellIndex)[WordIndex];
+				while (AffectedTiles != 0)
+				{
+					const int32 TileIndex = WordIndex * FWFC3DDomainUtils::BitsPerWord + static_cast<int32>(FMath::CountTrailingZeros64(AffectedTiles));
+					AffectedTiles &= AffectedTiles - 1;
+
+					if (--SupportCounts[TileIndex] == 0 && !RemoveTile(NextCellIndex, TileIndex, Grid, RemovedTiles, Result))
+					{
+						return false;
+					}
+				}
+			}
+		}
+		return true;
+	}
+}
 
 namespace WFC3DPropagateFunctions
 {
@@ -33,31 +581,48 @@ namespace WFC3DPropagateFunctions
 			return Result;
 		}
 
-		for (FWFC3DCell& Cell : *Grid->GetAllCells())
+		if (PropagationStrategy.PropagationMethod == EPropagationMethod::SupportCounting)
 		{
-			// 붕괴하지 않은 모든 셀의 bIsPropagated 플래그를 false로 초기화
-			if (!Cell.bIsCollapsed)
-			{
-				Cell.bIsPropagated = false;
-			}
+			return ExecuteSupportCountingPropagation(Context);
 		}
 
-		// Propagation Queue 초기화
-		TQueue<FIntVector> PropagationQueue;
+		// 지지 수를 갱신하지 않고 도메인을 바꾸므로 AC-4 지지 수는 더 이상 유효하지 않음
+		Grid->InvalidateSupportCounts();
+
+		if (PropagationStrategy.PropagationMethod == EPropagationMethod::ParallelFixpoint)
+		{
+			return ExecuteParallelPropagation(Context, PropagationStrategy);
+		}
+
+		// 새 전파 단계 시작 (이전 단계에서 전파된 셀을 순회하지 않고 초기화)
+		Grid->BeginPropagationEpoch();
+
+		// Grid가 소유한 전파 대기 목록 사용 (셀 당 한 번만 대기)
+		FWFC3DCellWorklist& PropagationQueue = Grid->GetPropagationWorklist();
+		PropagationQueue.Reset();
 		const FIntVector& CollapseLocation = Context.CollapseLocation;
+		const int32 CollapseCellIndex = Grid->GetCellIndex(CollapseLocation);
+		if (CollapseCellIndex == INDEX_NONE)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Invalid Collapse Location: %s"), *CollapseLocation.ToString());
+			return Result;
+		}
 
 		for (const EFace& Direction : FWFC3DFaceUtils::AllDirections)
 		{
-			FIntVector PropagationLocation = CollapseLocation + FWFC3DFaceUtils::GetDirectionVector(Direction);
-			FWFC3DCell* CellToPropagate = Grid->GetCell(PropagationLocation);
-			if (CellToPropagate == nullptr || CellToPropagate->bIsCollapsed || CellToPropagate->bIsPropagated)
+			const int32 CellIndexToPropagate = Grid->GetNeighbourIndex(CollapseCellIndex, Direction);
+			if (CellIndexToPropagate == INDEX_NONE || Grid->IsCollapsed(CellIndexToPropagate) || Grid->IsPropagated(CellIndexToPropagate))
 			{
 				continue;
 			}
-			CellToPropagate->SetPropagatedFaces(FWFC3DFaceUtils::GetOpposite(Direction));
-			PropagationQueue.Enqueue(PropagationLocation);
+			Grid->SetPropagatedFace(CellIndexToPropagate, FWFC3DFaceUtils::GetOpposite(Direction));
+			PropagationQueue.Enqueue(CellIndexToPropagate);
 		}
 
+		// 타일 워드 수와 전파 방식에 맞는 전파 커널 선택
+		const bool bFixpoint = PropagationStrategy.PropagationMethod == EPropagationMethod::Fixpoint;
+		const FPropagateCellFuncPtr PropagateCellFuncPtr = GetPropagateCellFunction(Grid->GetTileWordsNum(), bFixpoint);
+
 		// Range Limit 함수
 		RangeLimitFunc RangeLimitFuncPtr = nullptr;
 		if (PropagationStrategy.RangeLimitStrategy != ERangeLimitStrategy::Disable && Context.RangeLimit != 0)
@@ -68,31 +633,33 @@ namespace WFC3DPropagateFunctions
 		// Propagation
 		while (!PropagationQueue.IsEmpty())
 		{
-			FIntVector PropagationLocation;
-			PropagationQueue.Dequeue(PropagationLocation);
-			FWFC3DCell* PropagatedCell = Grid->GetCell(PropagationLocation);
+			int32 PropagatedCellIndex;
+			PropagationQueue.Dequeue(PropagatedCellIndex);
 
-			// 전파할 셀이 유효하지 않거나 이미 붕괴되었거나 전파된 경우 건너뜀
-			if (PropagatedCell == nullptr || PropagatedCell->bIsCollapsed || PropagatedCell->bIsPropagated)
+			// 이미 붕괴되었거나 전파된 경우 건너뜀 (Fixpoint는 도메인이 다시 줄어든 셀을 재방문)
+			const bool bFirstVisit = !Grid->IsPropagated(PropagatedCellIndex);
+			if (Grid->IsCollapsed(PropagatedCellIndex) || (!bFixpoint && !bFirstVisit))
 			{
 				continue;
 			}
 			// Range Limit 체크
-			if (RangeLimitFuncPtr != nullptr && !RangeLimitFuncPtr(CollapseLocation, PropagationLocation, Context.RangeLimit))
+			if (RangeLimitFuncPtr != nullptr && !RangeLimitFuncPtr(CollapseLocation, Grid->GetCellLocation(PropagatedCellIndex), Context.RangeLimit))
 			{
 				continue;
 			}
 
 			// 단일 셀 전파 함수 호출
-			if (PropagateCell(PropagatedCell, Grid, PropagationQueue, ModelData))
+			if (PropagateCellFuncPtr(PropagatedCellIndex, Grid, PropagationQueue, ModelData))
 			{
-				PropagatedCell->bIsPropagated = true;
-				// UE_LOG(LogTemp, Display, TEXT("Propagated Cell at Location: %s"), *PropagationLocation.ToString());
-				++Result.AffectedCellCount;
+				if (bFirstVisit)
+				{
+					Grid->SetPropagated(PropagatedCellIndex, true);
+					++Result.AffectedCellCount;
+				}
 			}
 			else
 			{
-				UE_LOG(LogTemp, Error, TEXT("Failed to propagate cell at Location: %s"), *PropagationLocation.ToString());
+				UE_LOG(LogTemp, Error, TEXT("Failed to propagate cell at Location: %s"), *Grid->GetCellLocation(PropagatedCellIndex).ToString());
 				Result.bSuccess = false;
 				return Result;
 			}
@@ -118,65 +685,64 @@ namespace WFC3DPropagateFunctions
 			return Result;
 		}
 
-		for (FWFC3DCell& Cell : *Grid->GetAllCells())
-		{
-			// 붕괴하지 않은 모든 셀의 bIsPropagated 플래그를 false로 초기화
-			if (!Cell.bIsCollapsed)
-			{
-				Cell.bIsPropagated = false;
-			}
-		}
+		Grid->InvalidateSupportCounts();
 
-		TQueue<FIntVector> PropagationQueue;
+		// 새 전파 단계 시작 (이전 단계에서 전파된 셀을 순회하지 않고 초기화)
+		Grid->BeginPropagationEpoch();
 
-		// Grid의 각 꼭지점 8개 넣으면 됨
-		// 전파 방향은 각 꼭지점 => 바깥 3면에서 전파 받기
-		TArray<FWFC3DCell*> CornerCells;
-		CornerCells.Add(Grid->GetCell(0, 0, 0));
-		CornerCells.Add(Grid->GetCell(0, 0, Grid->GetDimension().Z - 1));
-		CornerCells.Add(Grid->GetCell(0, Grid->GetDimension().Y - 1, 0));
-		CornerCells.Add(Grid->GetCell(0, Grid->GetDimension().Y - 1, Grid->GetDimension().Z - 1));
-		CornerCells.Add(Grid->GetCell(Grid->GetDimension().X - 1, 0, 0));
-		CornerCells.Add(Grid->GetCell(Grid->GetDimension().X - 1, 0, Grid->GetDimension().Z - 1));
-		CornerCells.Add(Grid->GetCell(Grid->GetDimension().X - 1, Grid->GetDimension().Y - 1, 0));
-		CornerCells.Add(Grid->GetCell(Grid->GetDimension().X - 1, Grid->GetDimension().Y - 1, Grid->GetDimension().Z - 1));
+		FWFC3DCellWorklist& PropagationQueue = Grid->GetPropagationWorklist();
+		PropagationQueue.Reset();
 
-		for (FWFC3DCell* Cell : CornerCells)
-		{
-			PropagationQueue.Enqueue(Cell->Location);
+		// 타일 워드 수에 맞는 전파 커널 선택
+		const FPropagateCellFuncPtr PropagateCellFuncPtr = GetPropagateCellFunction(Grid->GetTileWordsNum());
 
-			// 각 꼭지점 셀의 3면에 대해서 전파 받기
-			for (const EFace& Direction : FWFC3DFaceUtils::AllDirections)
+		if (Grid->GetSettings().bUseHaloLayer)
+		{
+			// Halo 셀은 붕괴된 셀과 같으므로, Halo 셀에서 인접한 Grid 셀로 전파 (Halo 셀과 연결된 FixedTile 면만)
+			for (int32 HaloCellIndex = 0; HaloCellIndex < Grid->Num(); ++HaloCellIndex)
 			{
-				FIntVector PropagationLocation = Cell->Location + FWFC3DFaceUtils::GetDirectionVector(Direction);
-				FWFC3DCell* CellToPropagate = Grid->GetCell(PropagationLocation);
-				if (CellToPropagate == nullptr)
+				if (!Grid->IsHalo(HaloCellIndex))
 				{
-					Cell->SetPropagatedFaces(Direction);
-					PropagationQueue.Enqueue(PropagationLocation);
+					continue;
+				}
+				for (const EFace& Direction : FWFC3DFaceUtils::AllDirections)
+				{
+					const int32 CellIndexToPropagate = Grid->GetNeighbourIndex(HaloCellIndex, Direction);
+					if (CellIndexToPropagate == INDEX_NONE || !Grid->IsGridCell(CellIndexToPropagate) ||
+						Grid->GetNeighbourIndex(CellIndexToPropagate, FWFC3DFaceUtils::GetOpposite(Direction)) != HaloCellIndex)
+					{
+						continue;
+					}
+					Grid->SetPropagatedFace(CellIndexToPropagate, FWFC3DFaceUtils::GetOpposite(Direction));
+					PropagationQueue.Enqueue(CellIndexToPropagate);
 				}
 			}
 		}
 
+		// Halo 셀과 연결되지 않은 경계 면은 외곽 셀에 경계 타일 마스크를 직접 적용하고, 줄어든 셀의 이웃부터 전파
+		if (!ApplyBoundaryShell(Grid, PropagationQueue))
+		{
+			Result.bSuccess = false;
+			return Result;
+		}
+
 		while (!PropagationQueue.IsEmpty())
 		{
-			FIntVector PropagationLocation;
-			if (!PropagationQueue.Dequeue(PropagationLocation))
+			int32 PropagatedCellIndex;
+			if (!PropagationQueue.Dequeue(PropagatedCellIndex))
 			{
 				continue;
 			}
-			FWFC3DCell* PropagatedCell = Grid->GetCell(PropagationLocation);
 
-			if (PropagatedCell == nullptr || PropagatedCell->bIsCollapsed || PropagatedCell->bIsPropagated)
+			if (Grid->IsCollapsed(PropagatedCellIndex) || Grid->IsPropagated(PropagatedCellIndex))
 			{
 				continue;
 			}
 
-			if (PropagateCell(PropagatedCell, Grid, PropagationQueue, ModelData))
+			if (PropagateCellFuncPtr(PropagatedCellIndex, Grid, PropagationQueue, ModelData))
 			{
 				Result.AffectedCellCount++;
-				PropagatedCell->bIsPropagated = true;
-				// UE_LOG(LogTemp, Display, TEXT("Initial Propagation at Location: %s"), *PropagationLocation.ToString());
+				Grid->SetPropagated(PropagatedCellIndex, true);
 			}
 			else
 			{
@@ -189,176 +755,261 @@ namespace WFC3DPropagateFunctions
 		return Result;
 	}
 
-	bool PropagateCell(FWFC3DCell* PropagatedCell, UWFC3DGrid* Grid, TQueue<FIntVector>& PropagationQueue,
-	                   const UWFC3DModelDataAsset* ModelData)
+	FPropagationResult ExecuteSupportCountingPropagation(const FWFC3DPropagationContext& Context)
 	{
-		if (PropagatedCell == nullptr || Grid == nullptr || ModelData == nullptr)
+		FPropagationResult Result;
+		UWFC3DGrid* Grid = Context.Grid;
+		const UWFC3DModelDataAsset* ModelData = Context.ModelData;
+
+		if (Grid == nullptr)
 		{
-			UE_LOG(LogTemp, Error, TEXT("Invalid PropagatedCell or Grid or ModelData"));
-			return false;
+			UE_LOG(LogTemp, Error, TEXT("Invalid Grid"));
+			return Result;
 		}
-		if (PropagatedCell->bIsCollapsed || PropagatedCell->bIsPropagated)
+		if (ModelData == nullptr)
 		{
-			UE_LOG(LogTemp, Error, TEXT("Cell already collapsed or propagated at Location: %s"), *PropagatedCell->Location.ToString());
-			return false;
+			UE_LOG(LogTemp, Error, TEXT("Invalid ModelData"));
+			return Result;
 		}
 
-		// UE_LOG(LogTemp, Display, TEXT("Current Propagated Cell Location: %s"), *PropagatedCell->Location.ToString());
+		const int32 CollapseCellIndex = Grid->GetCellIndex(Context.CollapseLocation);
+		if (CollapseCellIndex == INDEX_NONE)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Invalid Collapse Location: %s"), *Context.CollapseLocation.ToString());
+			return Result;
+		}
 
-		// UE_LOG(LogTemp, Error, TEXT(" BEFORE PROPAGATION RemainingTileOptionsBitset: %s"), *FBitString::ToString(PropagatedCell->RemainingTileOptionsBitset));
+		// 새 전파 단계 시작 (영향 받은 셀 수 계산용)
+		Grid->BeginPropagationEpoch();
 
-		// 전파 받은 면에 대해서 남은 타일 옵션을 가져와서 병합 -> 남은 타일 몹션에 대해서 전파 받지 않은 방향으로 전파
-		// 전파 받은 면에 대하여 전파 받은 면의 타일 옵션을 병합
-		for (const EFace Direction : FWFC3DFaceUtils::AllDirections)
+		// 제거된 타일 큐와 면 클래스 별 지지 수 (솔버 Arena에서 할당)
+		TWFC3DArenaQueue<FRemovedTile> RemovedTiles;
+		TArray<uint16, TWFC3DArenaAllocator> FaceSupportCounts;
+		FaceSupportCounts.SetNumZeroed(ModelData->GetFaceInfosNum());
+
+		bool bSuccess = true;
+		if (!Grid->HasValidSupportCounts())
 		{
-			FIntVector NextLocation = PropagatedCell->Location + FWFC3DFaceUtils::GetDirectionVector(Direction);
-			// 전파 받은 면이 아닌 경우에 가장 바깥이 아니라면 건너뜀
-			if (!PropagatedCell->IsFacePropagated(Direction) && Grid->IsValidLocation(NextLocation))
+			// 첫 호출이거나 지지 수 없이 도메인이 바뀐 경우 (초기 전파, 스냅샷 복원) 현재 도메인으로 모든 지지 수 계산
+			// 제거 처리 전에 모든 셀의 지지 수가 있어야 하므로 계산과 제거를 나누어 진행
+			if (!Grid->AllocateSupportCounts())
 			{
-				continue;
+				return Result;
 			}
-
-			// 전파 받은 면에 대해서 해당 면을 가질 수 있는 모든 타일 셋들을 OR로 병합
-			TBitArray<> MergedTileOptionsForDirection = TBitArray<>(false, ModelData->GetTileInfosNum());
-
-			// 전파 받은 면이 실제로 존재하는 경우
-			const FWFC3DCell* NextCell = Grid->GetCell(NextLocation);
-			if (NextCell != nullptr)
+			for (int32 Index = 0; Index < Grid->Num(); ++Index)
 			{
-				// UE_LOG(LogTemp, Display, TEXT("NextCell is Not Null"));
-				
-				TArray<int32> PropagatedFaceOptionIndices = FWFC3DHelperFunctions::GetAllIndexFromBitset(
-					NextCell->MergedFaceOptionsBitset[FWFC3DFaceUtils::GetOppositeIndex(Direction)]);
-
-				for (int32 FaceIndex : PropagatedFaceOptionIndices)
+				if (!Grid->IsGridCell(Index) || Grid->IsCollapsed(Index))
 				{
-					// UE_LOG(LogTemp, Display, TEXT("FaceIndex = %d"), FaceIndex);
-					
-					// 해당 타일 옵션과 OR 연산
-					const TBitArray<>* FaceIndexBitArray = ModelData->GetCompatibleTiles(FaceIndex);
-					MergedTileOptionsForDirection.CombineWithBitwiseOR(*FaceIndexBitArray, EBitwiseOperatorFlags::MaintainSize);
+					continue;
+				}
+				for (const EFace Direction : FWFC3DFaceUtils::AllDirections)
+				{
+					BuildSupportCounts(Index, Direction, Grid, ModelData, FaceSupportCounts);
 				}
 			}
-			// 존재하지 않는 경우에는 OuterCell에서 해당 면의 타일 옵션을 가져옴
-			else
+			for (int32 Index = 0; bSuccess && Index < Grid->Num(); ++Index)
 			{
-				int32 OppositeIndex = FWFC3DFaceUtils::GetOppositeIndex(Direction);
-
-				// UE_LOG(LogTemp, Display, TEXT("NextCell is Null"));
-				
-				// TODO: OuterCellTileInfo를 ModelData에 지정하기
-				// 현재는 0번 TileIndex를 OuterCell로 가정
-				const FTileInfo* OuterCellTileInfo = ModelData->GetTileInfo(0);
-				if (OuterCellTileInfo == nullptr)
+				if (!Grid->IsGridCell(Index) || Grid->IsCollapsed(Index))
 				{
-					UE_LOG(LogTemp, Error, TEXT("ModelData has no TileInfo at index 0"));
-					return false;
+					continue;
 				}
-				
-				int32 FaceIndex = OuterCellTileInfo->Faces[OppositeIndex];
-				if (FaceIndex < 0 || FaceIndex >= ModelData->GetFaceInfosNum())
+				for (const EFace Direction : FWFC3DFaceUtils::AllDirections)
 				{
-					UE_LOG(LogTemp, Error, TEXT("Invalid FaceIndex: %d for Direction: %s"), FaceIndex,
-					       *FWFC3DFaceUtils::GetDirectionVector(Direction).ToString());
-					return false;
+					if (!RemoveUnsupportedTiles(Index, Direction, Grid, RemovedTiles, Result))
+					{
+						bSuccess = false;
+						break;
+					}
 				}
-
-				const TBitArray<>* OuterCellTileOptions = ModelData->GetCompatibleTiles(FaceIndex);
-				if (OuterCellTileOptions == nullptr)
+			}
+		}
+		else
+		{
+			// 붕괴로 제거된 타일은 기록되지 않으므로, 붕괴된 셀을 향한 이웃의 지지 수만 다시 계산
+			for (const EFace Direction : FWFC3DFaceUtils::AllDirections)
+			{
+				const int32 NextCellIndex = Grid->GetNeighbourIndex(CollapseCellIndex, Direction);
+				if (NextCellIndex == INDEX_NONE || Grid->IsCollapsed(NextCellIndex))
 				{
-					UE_LOG(LogTemp, Error, TEXT("OuterCellTileOptions is null for Direction: %s"),
-					       *FWFC3DFaceUtils::GetDirectionVector(Direction).ToString());
-					return false;
+					continue;
+				}
+				const EFace OppositeDirection = FWFC3DFaceUtils::GetOpposite(Direction);
+				BuildSupportCounts(NextCellIndex, OppositeDirection, Grid, ModelData, FaceSupportCounts);
+				if (!RemoveUnsupportedTiles(NextCellIndex, OppositeDirection, Grid, RemovedTiles, Result))
+				{
+					bSuccess = false;
+					break;
 				}
-
-				MergedTileOptionsForDirection.CombineWithBitwiseOR(
-					*OuterCellTileOptions,
-					EBitwiseOperatorFlags::MaintainSize);
 			}
-			
-			// UE_LOG(LogTemp, Error, TEXT("Direction: %s"), *UEnum::GetValueAsString(Direction));
-			// UE_LOG(LogTemp, Warning, TEXT("BEFORE MERGING MergedTileOptionsForDirection: %s"), *FBitString::ToString(MergedTileOptionsForDirection));
-			// UE_LOG(LogTemp, Error, TEXT("  BEFORE MERGING    RemainingTileOptionsBitset: %s"),
-			//        *FBitString::ToString(PropagatedCell->RemainingTileOptionsBitset));
-			
-			// 전파 받은 면의 타일 옵션을 RemainingTileOptionsBitset과 And 연산
-			PropagatedCell->RemainingTileOptionsBitset.CombineWithBitwiseAND(MergedTileOptionsForDirection, EBitwiseOperatorFlags::MaintainSize);
-
-			// UE_LOG(LogTemp, Display, TEXT("AFTER  MERGING    RemainingTileOptionsBitset: %s"),
-			//        *FBitString::ToString(PropagatedCell->RemainingTileOptionsBitset));
 		}
 
-		int RemainingTileOptionsCount = PropagatedCell->RemainingTileOptionsBitset.CountSetBits();
-
-		// 전파 받은 타일 옵션의 개수가 이전과 같다면 전파하지 않음
-		if (PropagatedCell->Entropy == RemainingTileOptionsCount)
+		// Propagation - 제거된 타일마다 이웃 지지 수 갱신
+		FRemovedTile Removed;
+		while (bSuccess && RemovedTiles.Dequeue(Removed))
 		{
-			// UE_LOG(LogTemp, Display, TEXT("No change in remaining tile options at Location: %s"), *PropagatedCell->Location.ToString());
-			return true;
+			bSuccess = PropagateRemovedTile(Removed, Grid, ModelData, RemovedTiles, Result);
 		}
 
-		// 남은 타일 옵션이 없으면 전파 실패
-		if (RemainingTileOptionsCount == 0)
+		if (!bSuccess)
 		{
-			UE_LOG(LogTemp, Error, TEXT("No valid tile options left at Location: %s"), *PropagatedCell->Location.ToString());
-			// Grid->PrintGridInfo();
-			// UE_LOG(LogTemp, Error, TEXT("  AFTER PROPAGATION RemainingTileOptionsBitset: %s"), *FBitString::ToString(PropagatedCell->RemainingTileOptionsBitset));
-			// PropagatedCell->PrintCellInfo();
-			// PropagatedCell->PrintTileInfo();
-			return false;
+			// 중간에 멈춘 지지 수는 도메인과 맞지 않음
+			Grid->InvalidateSupportCounts();
+			UE_LOG(LogTemp, Error, TEXT("Failed to propagate support counts from Location: %s"), *Context.CollapseLocation.ToString());
+			Result.bSuccess = false;
+			return Result;
 		}
 
-		PropagatedCell->Entropy = RemainingTileOptionsCount;
+		Result.bSuccess = true;
+		return Result;
+	}
+
+	FPropagationResult ExecuteParallelPropagation(const FWFC3DPropagationContext& Context, const FPropagationStrategy& PropagationStrategy)
+	{
+		FPropagationResult Result;
+		UWFC3DGrid* Grid = Context.Grid;
+		const UWFC3DModelDataAsset* ModelData = Context.ModelData;
 
-		// MergedFaceOptionBit 초기화
-		for (const EFace& Direction : FWFC3DFaceUtils::AllDirections)
+		if (Grid == nullptr)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Invalid Grid"));
+			return Result;
+		}
+		if (ModelData == nullptr)
 		{
-			PropagatedCell->MergedFaceOptionsBitset[FWFC3DFaceUtils::GetIndex(Direction)].Init(false, ModelData->GetFaceInfosNum());
+			UE_LOG(LogTemp, Error, TEXT("Invalid ModelData"));
+			return Result;
 		}
 
+		const FIntVector& CollapseLocation = Context.CollapseLocation;
+		const int32 CollapseCellIndex = Grid->GetCellIndex(CollapseLocation);
+		if (CollapseCellIndex == INDEX_NONE)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Invalid Collapse Location: %s"), *CollapseLocation.ToString());
+			return Result;
+		}
 
-		// RemainingTileOptionsBitset에서 남은 타일 옵션을 가져와서 각 면들을 MergedFaceOptionsBitset에 병합
-		TArray<int32> TileIndices = FWFC3DHelperFunctions::GetAllIndexFromBitset(PropagatedCell->RemainingTileOptionsBitset);
+		// 새 전파 단계 시작 (영향 받은 셀 수 계산용)
+		Grid->BeginPropagationEpoch();
 
-		for (int32 TileIndex : TileIndices)
+		RangeLimitFunc RangeLimitFuncPtr = nullptr;
+		if (PropagationStrategy.RangeLimitStrategy != ERangeLimitStrategy::Disable && Context.RangeLimit != 0)
 		{
-			const FTileInfo* TileInfo = ModelData->GetTileInfo(TileIndex);
-			if (TileInfo == nullptr)
-			{
-				continue;
-			}
+			RangeLimitFuncPtr = FWFC3DFunctionMaps::GetRangeLimitFunction(PropagationStrategy.RangeLimitStrategy);
+		}
 
-			for (const EFace& Direction : FWFC3DFaceUtils::AllDirections)
+		// 다음 Frontier는 Grid의 전파 대기 목록으로 중복을 제거한 뒤 배열로 옮김
+		FWFC3DCellWorklist& NextFrontier = Grid->GetPropagationWorklist();
+		NextFrontier.Reset();
+		auto EnqueueNeighbours = [Grid, &NextFrontier, RangeLimitFuncPtr, &Context](const int32 CellIndex)
+		{
+			for (const EFace Direction : FWFC3DFaceUtils::AllDirections)
 			{
-				uint8 DirectionIndex = FWFC3DFaceUtils::GetIndex(Direction);
-				PropagatedCell->MergedFaceOptionsBitset[DirectionIndex][TileInfo->Faces[DirectionIndex]] = true;
+				const int32 NextCellIndex = Grid->GetNeighbourIndex(CellIndex, Direction);
+				if (NextCellIndex == INDEX_NONE || Grid->IsCollapsed(NextCellIndex))
+				{
+					continue;
+				}
+				if (RangeLimitFuncPtr != nullptr && !RangeLimitFuncPtr(Context.CollapseLocation, Grid->GetCellLocation(NextCellIndex), Context.RangeLimit))
+				{
+					continue;
+				}
+				NextFrontier.Enqueue(NextCellIndex);
 			}
-		}
+		};
+		EnqueueNeighbours(CollapseCellIndex);
 
-		for (const EFace& Direction : FWFC3DFaceUtils::AllDirections)
+		const int32 TileWordsNum = Grid->GetTileWordsNum();
+		const FIntersectNeighbourSupportsFuncPtr IntersectFuncPtr = WFC3DDispatchDomainWords(TileWordsNum, [](auto WordsTag) -> FIntersectNeighbourSupportsFuncPtr
 		{
-			// 전파 받은 면이면 건너뜀
-			if (PropagatedCell->IsFacePropagated(Direction))
+			return &IntersectNeighbourSupports<decltype(WordsTag)::Value>;
+		});
+
+		// Frontier 셀, 셀 별 계산된 도메인과 결과 (솔버 Arena에서 할당, 작업 스레드는 쓰기만 함)
+		TArray<int32, TWFC3DArenaAllocator> Frontier;
+		TArray<uint64, TWFC3DArenaAllocator> FrontierTileOptions;
+		TArray<int32, TWFC3DArenaAllocator> FrontierEntropies;
+		TArray<EFrontierCellResult, TWFC3DArenaAllocator> FrontierResults;
+
+		while (!NextFrontier.IsEmpty())
+		{
+			Frontier.Reset();
+			int32 CellIndex;
+			while (NextFrontier.Dequeue(CellIndex))
 			{
-				continue;
+				Frontier.Add(CellIndex);
 			}
 
-			// 전파 받지 않은 면에 대해서는 해당 방향으로 전파하기
-			FIntVector NextLocation = PropagatedCell->Location + FWFC3DFaceUtils::GetDirectionVector(Direction);
-			FWFC3DCell* CellToPropagate = Grid->GetCell(NextLocation);
-			if (CellToPropagate == nullptr || CellToPropagate->bIsCollapsed || CellToPropagate->bIsPropagated)
+			const int32 FrontierNum = Frontier.Num();
+			FrontierTileOptions.SetNumUninitialized(FrontierNum * TileWordsNum);
+			FrontierEntropies.SetNumUninitialized(FrontierNum);
+			FrontierResults.SetNumUninitialized(FrontierNum);
+
+			// 1. 모든 Frontier 셀의 새 도메인을 이전 단계의 도메인으로 병렬 계산 (Grid는 읽기만 함)
+			const UWFC3DGrid* ConstGrid = Grid;
+			ParallelFor(FrontierNum, [&](const int32 FrontierIndex)
 			{
-				continue;
-			}
+				const int32 FrontierCellIndex = Frontier[FrontierIndex];
+				uint64* TileOptions = FrontierTileOptions.GetData() + static_cast<int64>(FrontierIndex) * TileWordsNum;
+				const int32 RemainingTileOptionsCount = IntersectFuncPtr(FrontierCellIndex, ConstGrid, ModelData, TileOptions);
 
-			// 전파 받을 Cell에 대해서는 반대 방향에서 온 것 이므로 반대 방향에서 전파 받았다고 설정
-			CellToPropagate->SetPropagatedFaces(FWFC3DFaceUtils::GetOpposite(Direction));
-			PropagationQueue.Enqueue(NextLocation);
+				FrontierEntropies[FrontierIndex] = RemainingTileOptionsCount;
+				FrontierResults[FrontierIndex] = RemainingTileOptionsCount == 0
+					                                 ? EFrontierCellResult::Contradiction
+					                                 : RemainingTileOptionsCount == ConstGrid->GetEntropy(FrontierCellIndex)
+					                                 ? EFrontierCellResult::Unchanged
+					                                 : EFrontierCellResult::Narrowed;
+			}, FrontierNum < MinParallelFrontierNum);
+
+			// 2. Frontier 순서대로 결과 기록 (도메인 페이지 할당이 있으므로 단일 스레드)
+			for (int32 FrontierIndex = 0; FrontierIndex < FrontierNum; ++FrontierIndex)
+			{
+				const int32 FrontierCellIndex = Frontier[FrontierIndex];
+				if (FrontierResults[FrontierIndex] == EFrontierCellResult::Contradiction)
+				{
+					UE_LOG(LogTemp, Error, TEXT("No valid tile options left at Location: %s"), *Grid->GetCellLocation(FrontierCellIndex).ToString());
+					NextFrontier.Reset();
+					Result.bSuccess = false;
+					return Result;
+				}
+				if (FrontierResults[FrontierIndex] == EFrontierCellResult::Unchanged)
+				{
+					continue;
+				}
+
+				Grid->NarrowTileOptions(FrontierCellIndex, FrontierTileOptions.GetData() + static_cast<int64>(FrontierIndex) * TileWordsNum,
+				                        FrontierEntropies[FrontierIndex]);
+				if (!Grid->IsPropagated(FrontierCellIndex))
+				{
+					Grid->SetPropagated(FrontierCellIndex, true);
+					++Result.AffectedCellCount;
+				}
+				EnqueueNeighbours(FrontierCellIndex);
+			}
 		}
 
-		// 전파 성공
-		// UE_LOG(LogTemp, Display, TEXT("Successfully propagated cell at Location: %s"), *PropagatedCell->Location.ToString());
-		return true;
+		Result.bSuccess = true;
+		return Result;
+	}
+
+	void GatherSupportedTileOptions(const uint64* TileOptions, const int32 Entropy, const EFace Direction, uint64* OutSupportedTiles,
+	                                const UWFC3DModelDataAsset* ModelData)
+	{
+		const int32 TileWordsNum = ModelData->GetTileWordsNum();
+		WFC3DDispatchDomainWords(TileWordsNum, [&](auto WordsTag)
+		{
+			GatherSupportedTiles<decltype(WordsTag)::Value>(TileOptions, Entropy, Direction, OutSupportedTiles, TileWordsNum, ModelData);
+		});
+	}
+
+	bool PropagateCell(const int32 PropagatedCellIndex, UWFC3DGrid* Grid, FWFC3DCellWorklist& PropagationQueue,
+	                   const UWFC3DModelDataAsset* ModelData)
+	{
+		if (Grid == nullptr || ModelData == nullptr)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Invalid PropagatedCell or Grid or ModelData"));
+			return false;
+		}
+		return GetPropagateCellFunction(Grid->GetTileWordsNum())(PropagatedCellIndex, Grid, PropagationQueue, ModelData);
 	}
 
 	namespace RangeLimit
@@ -0,0 +1,512 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "WFC/Algorithm/WFC3DRegionSolver.h"
+#include "Async/ParallelFor.h"
+#include "Containers/Queue.h"
+#include "WFC/Algorithm/WFC3DPropagation.h"
+#include "WFC/Data/WFC3DGrid.h"
+#include "WFC/Data/WFC3DModelDataAsset.h"
+#include "WFC/Utility/WFC3DCellWorklist.h"
+#include "WFC/Utility/WFC3DDomainUtils.h"
+#include "WFC/Utility/WFC3DWeightedSampler.h"
+
+namespace
+{
+	/** 다른 영역 셀에 보내는 제약 (셀에 허용되는 타일 마스크, 고정 크기 도메인 범위에서는 메시지 안에 저장) */
+	struct FRegionMessage
+	{
+		int32 CellIndex = INDEX_NONE;
+		TArray<uint64, TInlineAllocator<FWFC3DDomainUtils::MaxFixedWords>> TileMask;
+	};
+
+	/** 영역 Entropy 힙 항목, 같은 Entropy는 Noise로 무작위 순서 */
+	struct FEntropyEntry
+	{
+		int32 Entropy = 0;
+		float Noise = 0.0f;
+		int32 CellIndex = INDEX_NONE;
+	};
+
+	struct FEntropyEntryLess
+	{
+		FORCEINLINE bool operator()(const FEntropyEntry& A, const FEntropyEntry& B) const
+		{
+			return A.Entropy != B.Entropy ? A.Entropy < B.Entropy : A.Noise < B.Noise;
+		}
+	};
+}
+
+struct FWFC3DRegionSolver::FRegion
+{
+	int32 RegionIndex = INDEX_NONE;
+
+	/** 영역의 Grid 셀 인덱스 */
+	TArray<int32> Cells;
+
+	/** 영역 안의 인덱스 별 다른 영역 이웃 존재 여부 */
+	TArray<uint64> BorderBits;
+
+	/** 전파 대기 셀 (영역 안의 인덱스) */
+	FWFC3DCellWorklist Worklist;
+
+	/** 붕괴 대상 셀 Entropy 힙 (지난 기록은 꺼낼 때 무시) */
+	TArray<FEntropyEntry> EntropyHeap;
+
+	/** 다른 영역 작업 스레드가 보낸 제약 */
+	TQueue<FRegionMessage, EQueueMode::Mpsc> Mailbox;
+
+	/** 이번 라운드에 붕괴된 셀 */
+	TArray<int32> CollapsedCells;
+
+	FRandomStream RandomStream;
+
+	/** 전파 계산용 버퍼 (TileWordsNum 워드) */
+	TArray<uint64> NewTileOptions;
+	TArray<uint64> SupportedTileOptions;
+
+	/** 이번 라운드에 처음 쓴 셀과 쓰기 전 상태 / 도메인 (모순이면 되돌림) */
+	TArray<int32> UndoCells;
+	TArray<FWFC3DCellState> UndoCellStates;
+	TArray<uint64> UndoTileOptions;
+
+	/** 영역 안의 인덱스 별 이번 라운드 기록 여부 */
+	TArray<uint64> UndoRecordedBits;
+
+	FORCEINLINE bool IsBorder(const int32 LocalIndex) const
+	{
+		return FWFC3DDomainUtils::TestBit(BorderBits.GetData(), LocalIndex);
+	}
+};
+
+FWFC3DRegionSolver::FWFC3DRegionSolver(UWFC3DGrid* InGrid, const UWFC3DModelDataAsset* InModelData, const FWFC3DRegionSolverSettings& InSettings,
+                                       const int32 InSeed)
+	: Grid(InGrid), ModelData(InModelData), Settings(InSettings), Seed(InSeed)
+{
+}
+
+FWFC3DRegionSolver::~FWFC3DRegionSolver() = default;
+
+bool FWFC3DRegionSolver::Solve()
+{
+	if (Grid == nullptr || ModelData == nullptr)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Invalid Parameters for RegionSolver"));
+		return false;
+	}
+
+	RollbacksNum = 0;
+	RoundsNum = 0;
+
+	// 1단계: 영역 내부 셀을 영역 별로 병렬 붕괴
+	BuildRegions(Settings.RegionCounts, false);
+	if (Regions.Num() > 1)
+	{
+		if (!RunPhase(true))
+		{
+			return false;
+		}
+
+		// 2단계: 영역을 반 영역 크기만큼 밀어, 1단계 경계 셀 대부분을 새 영역의 내부 셀로 병렬 붕괴
+		BuildRegions(Settings.RegionCounts, true);
+		if (!RunPhase(true))
+		{
+			return false;
+		}
+	}
+
+	// 3단계: 두 분할 모두에서 경계인 남은 셀을 단일 영역으로 붕괴
+	BuildRegions(FIntVector(1, 1, 1), false);
+	if (!RunPhase(false))
+	{
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("RegionSolver Finished - Rounds: %d, Rollbacks: %d"), RoundsNum, RollbacksNum);
+	return true;
+}
+
+void FWFC3DRegionSolver::BuildRegions(const FIntVector& RegionCounts, const bool bShifted)
+{
+	const FIntVector Dimension = Grid->GetDimension();
+	const FIntVector Counts(FMath::Clamp(RegionCounts.X, 1, Dimension.X), FMath::Clamp(RegionCounts.Y, 1, Dimension.Y),
+	                        FMath::Clamp(RegionCounts.Z, 1, Dimension.Z));
+	const FIntVector Offset = bShifted ? FIntVector(Dimension.X / (Counts.X * 2), Dimension.Y / (Counts.Y * 2), Dimension.Z / (Counts.Z * 2))
+	                                   : FIntVector::ZeroValue;
+	const int32 TileWordsNum = Grid->GetTileWordsNum();
+
+	Regions.Reset();
+	for (int32 RegionIndex = 0; RegionIndex < Counts.X * Counts.Y * Counts.Z; ++RegionIndex)
+	{
+		TUniquePtr<FRegion> Region = MakeUnique<FRegion>();
+		Region->RegionIndex = RegionIndex;
+		Region->RandomStream.Initialize(HashCombine(GetTypeHash(Seed), GetTypeHash(RegionIndex)));
+		Region->NewTileOptions.SetNumZeroed(TileWordsNum);
+		Region->SupportedTileOptions.SetNumZeroed(TileWordsNum);
+		Regions.Add(MoveTemp(Region));
+	}
+
+	// 셀을 Grid 좌표로 영역에 배정 (밀린 분할은 Grid 끝을 넘는 셀을 첫 영역으로 감쌈)
+	CellRegions.Init(INDEX_NONE, Grid->Num());
+	CellLocalIndices.Init(INDEX_NONE, Grid->Num());
+	for (int32 CellIndex = 0; CellIndex < Grid->Num(); ++CellIndex)
+	{
+		if (!Grid->IsGridCell(CellIndex))
+		{
+			continue;
+		}
+		const FIntVector Location = Grid->GetCellLocation(CellIndex) + Offset;
+		const int32 RegionIndex = Location.X % Dimension.X * Counts.X / Dimension.X
+			+ (Location.Y % Dimension.Y * Counts.Y / Dimension.Y) * Counts.X
+			+ (Location.Z % Dimension.Z * Counts.Z / Dimension.Z) * Counts.X * Counts.Y;
+		FRegion& Region = *Regions[RegionIndex];
+		CellRegions[CellIndex] = RegionIndex;
+		CellLocalIndices[CellIndex] = Region.Cells.Add(CellIndex);
+	}
+
+	// 다른 영역 이웃을 가진 경계 셀 표시
+	for (const TUniquePtr<FRegion>& Region : Regions)
+	{
+		Region->BorderBits.SetNumZeroed(FWFC3DDomainUtils::GetWordsNum(Region->Cells.Num()));
+		Region->UndoRecordedBits.SetNumZeroed(FWFC3DDomainUtils::GetWordsNum(Region->Cells.Num()));
+		Region->Worklist.Initialize(Region->Cells.Num());
+		for (int32 LocalIndex = 0; LocalIndex < Region->Cells.Num(); ++LocalIndex)
+		{
+			for (const EFace Direction : FWFC3DFaceUtils::AllDirections)
+			{
+				const int32 NextCellIndex = Grid->GetNeighbourIndex(Region->Cells[LocalIndex], Direction);
+				if (NextCellIndex != INDEX_NONE && CellRegions[NextCellIndex] != INDEX_NONE && CellRegions[NextCellIndex] != Region->RegionIndex)
+				{
+					FWFC3DDomainUtils::SetBit(Region->BorderBits.GetData(), LocalIndex);
+					break;
+				}
+			}
+		}
+	}
+}
+
+bool FWFC3DRegionSolver::RunPhase(const bool bInteriorOnly)
+{
+	bCurrentInteriorOnly = bInteriorOnly;
+	bContradiction = false;
+
+	// 붕괴되지 않은 셀이 모두 공유하지 않는 페이지에 도메인을 가지도록 단계마다 한 번만 준비
+	// 라운드 롤백 지점은 Grid 스냅샷 대신 영역 별 실행 취소 기록으로 남겨 라운드 비용이 쓴 셀 수에만 비례
+	Grid->PrepareConcurrentWrites();
+	ResetRegionsAfterRollback();
+
+	while (true)
+	{
+		++RoundsNum;
+		ParallelFor(Regions.Num(), [this](const int32 RegionIndex)
+		{
+			RunRegion(*Regions[RegionIndex]);
+		});
+		SettleMailboxes();
+
+		if (bContradiction)
+		{
+			if (++RollbacksNum > Settings.MaxRollbacks)
+			{
+				UE_LOG(LogTemp, Error, TEXT("RegionSolver Failed - Too many rollbacks (%d)"), RollbacksNum);
+				return false;
+			}
+			UndoRound();
+			bContradiction = false;
+			ResetRegionsAfterRollback();
+			continue;
+		}
+
+		int32 CollapsedNum = 0;
+		for (const TUniquePtr<FRegion>& Region : Regions)
+		{
+			Grid->FinishConcurrentCollapses(Region->CollapsedCells);
+			CollapsedNum += Region->CollapsedCells.Num();
+			Region->CollapsedCells.Reset();
+			ClearUndo(*Region);
+		}
+		if (CollapsedNum == 0)
+		{
+			return true;
+		}
+	}
+}
+
+void FWFC3DRegionSolver::RunRegion(FRegion& Region)
+{
+	const int32 TileWordsNum = Grid->GetTileWordsNum();
+	for (int32 CollapseCount = 0; CollapseCount < Settings.CollapsesPerRound; ++CollapseCount)
+	{
+		if (bContradiction)
+		{
+			return;
+		}
+		if (!DrainMailbox(Region))
+		{
+			bContradiction = true;
+			return;
+		}
+
+		const int32 CellIndex = PopLowestEntropyCell(Region);
+		if (CellIndex == INDEX_NONE)
+		{
+			return;
+		}
+
+		// 남은 타일 옵션 중 가중치 비율로 선택
+		const int32 SelectedTileIndex = FWFC3DWeightedSampler::SampleDomain(Grid->GetTileOptions(CellIndex), TileWordsNum,
+		                                                                    ModelData->GetTileSampleWeights(), Region.RandomStream);
+		if (SelectedTileIndex == INDEX_NONE)
+		{
+			bContradiction = true;
+			return;
+		}
+
+		RecordUndo(Region, CellIndex);
+		Grid->CollapseCellConcurrent(CellIndex, SelectedTileIndex);
+		Region.CollapsedCells.Add(CellIndex);
+		NotifyNeighbours(Region, CellIndex);
+		if (!ProcessWorklist(Region))
+		{
+			bContradiction = true;
+			return;
+		}
+	}
+}
+
+void FWFC3DRegionSolver::SettleMailboxes()
+{
+	bool bPending = true;
+	while (bPending && !bContradiction)
+	{
+		ParallelFor(Regions.Num(), [this](const int32 RegionIndex)
+		{
+			FRegion& Region = *Regions[RegionIndex];
+			if (!bContradiction && !Region.Mailbox.IsEmpty() && !DrainMailbox(Region))
+			{
+				bContradiction = true;
+			}
+		});
+
+		// 전달 중 다른 영역으로 보낸 메시지가 남았으면 반복
+		bPending = false;
+		for (const TUniquePtr<FRegion>& Region : Regions)
+		{
+			bPending |= !Region->Mailbox.IsEmpty();
+		}
+	}
+}
+
+bool FWFC3DRegionSolver::DrainMailbox(FRegion& Region)
+{
+	const int32 TileWordsNum = Grid->GetTileWordsNum();
+	FRegionMessage Message;
+	while (Region.Mailbox.Dequeue(Message))
+	{
+		const int32 CellIndex = Message.CellIndex;
+		if (Grid->IsCollapsed(CellIndex))
+		{
+			// 이미 붕괴된 셀은 선택된 타일이 허용되는지만 확인
+			if (!FWFC3DDomainUtils::TestBit(Message.TileMask.GetData(), Grid->GetCollapsedTileIndex(CellIndex)))
+			{
+				return false;
+			}
+			continue;
+		}
+
+		// 셀 도메인에 바로 And (모순이면 롤백되므로 빈 도메인이 남아도 됨)
+		RecordUndo(Region, CellIndex);
+		const FWFC3DDomainChange Change = FWFC3DDomainUtils::AndIntoWithChange(Grid->GetTileOptions(CellIndex), Message.TileMask.GetData(), TileWordsNum);
+		if (!Change.bChanged)
+		{
+			continue;
+		}
+		if (Change.SetBitsNum == 0)
+		{
+			return false;
+		}
+
+		Grid->SetEntropy(CellIndex, Change.SetBitsNum);
+		PushEntropy(Region, CellIndex);
+		NotifyNeighbours(Region, CellIndex);
+	}
+	return ProcessWorklist(Region);
+}
+
+bool FWFC3DRegionSolver::ProcessWorklist(FRegion& Region)
+{
+	const int32 TileWordsNum = Grid->GetTileWordsNum();
+	uint64* NewTileOptions = Region.NewTileOptions.GetData();
+	uint64* SupportedTileOptions = Region.SupportedTileOptions.GetData();
+
+	int32 LocalIndex;
+	while (Region.Worklist.Dequeue(LocalIndex))
+	{
+		const int32 CellIndex = Region.Cells[LocalIndex];
+		if (Grid->IsCollapsed(CellIndex))
+		{
+			continue;
+		}
+
+		// 다른 영역 이웃은 읽지 않음 (Mailbox 메시지로 이미 반영), Grid 밖 방향은 초기 전파에서 경계 타일 마스크로 이미 반영
+		uint64* TileOptions = Grid->GetTileOptions(CellIndex);
+		FWFC3DDomainUtils::Copy(NewTileOptions, TileOptions, TileWordsNum);
+		int32 NewEntropy = Grid->GetEntropy(CellIndex);
+		for (const EFace Direction : FWFC3DFaceUtils::AllDirections)
+		{
+			const int32 NextCellIndex = Grid->GetNeighbourIndex(CellIndex, Direction);
+			const EFace OppositeDirection = FWFC3DFaceUtils::GetOpposite(Direction);
+			if (NextCellIndex == INDEX_NONE || (CellRegions[NextCellIndex] != INDEX_NONE && CellRegions[NextCellIndex] != Region.RegionIndex))
+			{
+				continue;
+			}
+			else if (Grid->GetCollapsedTileIndex(NextCellIndex) != UWFC3DGrid::InvalidTileIndex)
+			{
+				NewEntropy = FWFC3DDomainUtils::AndIntoWithChange(
+					NewTileOptions, ModelData->GetTileCompatibleWords(Grid->GetCollapsedTileIndex(NextCellIndex), OppositeDirection), TileWordsNum).SetBitsNum;
+			}
+			else
+			{
+				WFC3DPropagateFunctions::GatherSupportedTileOptions(Grid->GetTileOptions(NextCellIndex), Grid->GetEntropy(NextCellIndex), OppositeDirection,
+				                                                    SupportedTileOptions, ModelData);
+				NewEntropy = FWFC3DDomainUtils::AndIntoWithChange(NewTileOptions, SupportedTileOptions, TileWordsNum).SetBitsNum;
+			}
+		}
+
+		if (NewEntropy == Grid->GetEntropy(CellIndex))
+		{
+			continue;
+		}
+		if (NewEntropy == 0)
+		{
+			return false;
+		}
+
+		RecordUndo(Region, CellIndex);
+		FWFC3DDomainUtils::Copy(TileOptions, NewTileOptions, TileWordsNum);
+		Grid->SetEntropy(CellIndex, NewEntropy);
+		PushEntropy(Region, CellIndex);
+		NotifyNeighbours(Region, CellIndex);
+	}
+	return true;
+}
+
+void FWFC3DRegionSolver::NotifyNeighbours(FRegion& Region, const int32 CellIndex)
+{
+	const int32 TileWordsNum = Grid->GetTileWordsNum();
+	const bool bCollapsed = Grid->IsCollapsed(CellIndex);
+	for (const EFace Direction : FWFC3DFaceUtils::AllDirections)
+	{
+		const int32 NextCellIndex = Grid->GetNeighbourIndex(CellIndex, Direction);
+		if (NextCellIndex == INDEX_NONE || CellRegions[NextCellIndex] == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const int32 NextRegionIndex = CellRegions[NextCellIndex];
+		if (NextRegionIndex == Region.RegionIndex)
+		{
+			if (!Grid->IsCollapsed(NextCellIndex))
+			{
+				Region.Worklist.Enqueue(CellLocalIndices[NextCellIndex]);
+			}
+			continue;
+		}
+
+		// 다른 영역 이웃에는 이 셀이 허용하는 타일 마스크를 전달
+		FRegionMessage Message;
+		Message.CellIndex = NextCellIndex;
+		Message.TileMask.SetNumUninitialized(TileWordsNum);
+		if (bCollapsed)
+		{
+			FWFC3DDomainUtils::Copy(Message.TileMask.GetData(), ModelData->GetTileCompatibleWords(Grid->GetCollapsedTileIndex(CellIndex), Direction),
+			                        TileWordsNum);
+		}
+		else
+		{
+			WFC3DPropagateFunctions::GatherSupportedTileOptions(Grid->GetTileOptions(CellIndex), Grid->GetEntropy(CellIndex), Direction,
+			                                                    Message.TileMask.GetData(), ModelData);
+		}
+		Regions[NextRegionIndex]->Mailbox.Enqueue(MoveTemp(Message));
+	}
+}
+
+int32 FWFC3DRegionSolver::PopLowestEntropyCell(FRegion& Region)
+{
+	FEntropyEntry Entry;
+	while (Region.EntropyHeap.Num() > 0)
+	{
+		Region.EntropyHeap.HeapPop(Entry, FEntropyEntryLess());
+		if (!Grid->IsCollapsed(Entry.CellIndex) && Grid->GetEntropy(Entry.CellIndex) == Entry.Entropy)
+		{
+			return Entry.CellIndex;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void FWFC3DRegionSolver::PushEntropy(FRegion& Region, const int32 CellIndex)
+{
+	if (bCurrentInteriorOnly && Region.IsBorder(CellLocalIndices[CellIndex]))
+	{
+		return;
+	}
+	Region.EntropyHeap.HeapPush({Grid->GetEntropy(CellIndex), Region.RandomStream.GetFraction(), CellIndex}, FEntropyEntryLess());
+}
+
+void FWFC3DRegionSolver::RecordUndo(FRegion& Region, const int32 CellIndex)
+{
+	const int32 LocalIndex = CellLocalIndices[CellIndex];
+	if (FWFC3DDomainUtils::TestBit(Region.UndoRecordedBits.GetData(), LocalIndex))
+	{
+		return;
+	}
+	FWFC3DDomainUtils::SetBit(Region.UndoRecordedBits.GetData(), LocalIndex);
+
+	const UWFC3DGrid* ConstGrid = Grid;
+	Region.UndoCells.Add(CellIndex);
+	Region.UndoCellStates.Add(ConstGrid->GetCellState(CellIndex));
+	Region.UndoTileOptions.Append(ConstGrid->GetTileOptions(CellIndex), Grid->GetTileWordsNum());
+}
+
+void FWFC3DRegionSolver::UndoRound()
+{
+	const int32 TileWordsNum = Grid->GetTileWordsNum();
+	for (const TUniquePtr<FRegion>& Region : Regions)
+	{
+		for (int32 UndoIndex = 0; UndoIndex < Region->UndoCells.Num(); ++UndoIndex)
+		{
+			Grid->RestoreCellConcurrent(Region->UndoCells[UndoIndex], Region->UndoCellStates[UndoIndex],
+			                            Region->UndoTileOptions.GetData() + static_cast<int64>(UndoIndex) * TileWordsNum);
+		}
+		ClearUndo(*Region);
+	}
+}
+
+void FWFC3DRegionSolver::ClearUndo(FRegion& Region)
+{
+	for (const int32 CellIndex : Region.UndoCells)
+	{
+		FWFC3DDomainUtils::ClearBit(Region.UndoRecordedBits.GetData(), CellLocalIndices[CellIndex]);
+	}
+	Region.UndoCells.Reset();
+	Region.UndoCellStates.Reset();
+	Region.UndoTileOptions.Reset();
+}
+
+void FWFC3DRegionSolver::ResetRegionsAfterRollback()
+{
+	for (const TUniquePtr<FRegion>& Region : Regions)
+	{
+		Region->Mailbox.Empty();
+		Region->Worklist.Reset();
+		Region->CollapsedCells.Reset();
+		Region->EntropyHeap.Reset();
+		for (const int32 CellIndex : Region->Cells)
+		{
+			if (!Grid->IsCollapsed(CellIndex))
+			{
+				PushEntropy(*Region, CellIndex);
+			}
+		}
+	}
+}
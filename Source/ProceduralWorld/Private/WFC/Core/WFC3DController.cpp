@@ -7,6 +7,7 @@
 #include "Engine/Engine.h"
 #include "Components/SceneComponent.h"
 #include "Async/Async.h"
+#include "UObject/GarbageCollection.h"
 
 UWFC3DController::UWFC3DController()
 	: bIsRunning(false)
@@ -74,11 +75,22 @@ void UWFC3DController::BeginDestroy()
 	}
 	
 	// GeneratedGrid 정리
+	FScopeLock GridPoolLock(&GridPoolCriticalSection);
 	if (GeneratedGrid && IsValid(GeneratedGrid))
 	{
 		GeneratedGrid->ConditionalBeginDestroy();
 		GeneratedGrid = nullptr;
 	}
+
+	// GridPool 정리
+	for (UWFC3DGrid* PooledGrid : GridPool)
+	{
+		if (IsValid(PooledGrid))
+		{
+			PooledGrid->ConditionalBeginDestroy();
+		}
+	}
+	GridPool.Empty();
 	
 	// Algorithm과 Visualizer는 CreateDefaultSubobject로 생성되었으므로 자동으로 정리됨
 	
@@ -347,6 +359,17 @@ FWFC3DAlgorithmResult UWFC3DController::ExecuteAlgorithm(const FWFC3DExecutionCo
 
 	FWFC3DAlgorithmResult FinalResult;
 	FinalResult.bSuccess = false;
+
+	// 이전 실행에서 생성된 Grid는 GetGeneratedGrid / 시각화로 외부에 공개되었으므로 Pool에 넣지 않고,
+	// 이번 실행이 성공할 때까지 그대로 유지 (교체된 Grid는 참조가 없어지면 GC가 회수)
+	UWFC3DGrid* Grid = AcquireGrid(Context);
+	if (!Grid)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to create Grid!"));
+		FinalResult.ErrorMessage = TEXT("Failed to create Grid");
+		SetCurrentPhase(TEXT("Algorithm Failed"));
+		return FinalResult;
+	}
 	
 	// 재시도 로직 - MaxRetryCount만큼 시도
 	for (int32 AttemptCount = 1; AttemptCount <= Context.MaxRetryCount; AttemptCount++)
@@ -363,21 +386,13 @@ FWFC3DAlgorithmResult UWFC3DController::ExecuteAlgorithm(const FWFC3DExecutionCo
 		UE_LOG(LogTemp, Warning, TEXT("=== WFC Algorithm Attempt %d/%d ==="), AttemptCount, Context.MaxRetryCount);
 		SetCurrentPhase(FString::Printf(TEXT("Algorithm (Attempt %d/%d)"), AttemptCount, Context.MaxRetryCount), 0.0f);
 		
-		UE_LOG(LogTemp, Log, TEXT("Creating Grid for attempt %d..."), AttemptCount);
-		// 그리드 생성 - 런타임에서는 NewObject 사용 가능 (Transient로 생성하여 GC 문제 방지)
-		UWFC3DGrid* Grid = NewObject<UWFC3DGrid>(GetTransientPackage());
-		if (!Grid)
+		// 첫 시도는 Pool에서 가져온 초기화된 Grid를 사용하고, 재시도는 같은 Grid를 초기 상태로 되돌려 재사용
+		if (AttemptCount > 1)
 		{
-			UE_LOG(LogTemp, Error, TEXT("Failed to create Grid for attempt %d!"), AttemptCount);
-			FinalResult.ErrorMessage = TEXT("Failed to create Grid");
-			continue; // 다음 시도로 넘어감
+			Grid->Reset();
+			UE_LOG(LogTemp, Log, TEXT("Grid reset for attempt %d"), AttemptCount);
 		}
 		
-		UE_LOG(LogTemp, Log, TEXT("Grid created successfully for attempt %d, initializing..."), AttemptCount);
-		// 그리드 초기화
-		Grid->InitializeGrid(Context.GridDimension, Context.ModelData);
-		UE_LOG(LogTemp, Log, TEXT("Grid initialized successfully for attempt %d"), AttemptCount);
-		
 		UE_LOG(LogTemp, Log, TEXT("Setting up Algorithm context for attempt %d..."), AttemptCount);
 		// 알고리즘 컨텍스트 구성
 		FWFC3DAlgorithmContext AlgorithmContext;
@@ -417,7 +432,7 @@ FWFC3DAlgorithmResult UWFC3DController::ExecuteAlgorithm(const FWFC3DExecutionCo
 		if (Result.bSuccess)
 		{
 			UE_LOG(LogTemp, Warning, TEXT("=== WFC Algorithm SUCCEEDED on attempt %d/%d ==="), AttemptCount, Context.MaxRetryCount);
-			GeneratedGrid = Grid; // 이미 Algorithm이 Grid를 수정했으므로 그대로 사용
+			PublishGrid(Grid); // 이미 Algorithm이 Grid를 수정했으므로 그대로 사용
 			SetCurrentPhase(TEXT("Algorithm"), 1.0f);
 			UE_LOG(LogTemp, Log, TEXT("Algorithm phase completed successfully on attempt %d"), AttemptCount);
 			
@@ -450,6 +465,7 @@ FWFC3DAlgorithmResult UWFC3DController::ExecuteAlgorithm(const FWFC3DExecutionCo
 	// 모든 시도가 실패한 경우
 	if (!FinalResult.bSuccess)
 	{
+		ReleaseGrid(Grid);
 		UE_LOG(LogTemp, Error, TEXT("=== WFC Algorithm FAILED after %d attempts ==="), Context.MaxRetryCount);
 		SetCurrentPhase(TEXT("Algorithm Failed"));
 		UE_LOG(LogTemp, Error, TEXT("WFC3D Algorithm failed after %d attempts. Last error: %s"), Context.MaxRetryCount, *FinalResult.ErrorMessage);
@@ -458,6 +474,76 @@ FWFC3DAlgorithmResult UWFC3DController::ExecuteAlgorithm(const FWFC3DExecutionCo
 	return FinalResult;
 }
 
+UWFC3DGrid* UWFC3DController::AcquireGrid(const FWFC3DExecutionContext& Context)
+{
+	// ExecuteAsync에서는 백그라운드 스레드에서 호출되므로, UPROPERTY 배열을 바꾸고 새 Grid를 참조할 때까지 GC 시작을 막음
+	UWFC3DGrid* PooledGrid = nullptr;
+	UWFC3DGrid* Grid = nullptr;
+	{
+		FGCScopeGuard GCGuard;
+		FScopeLock GridPoolLock(&GridPoolCriticalSection);
+		for (int32 PoolIndex = GridPool.Num() - 1; PoolIndex >= 0; --PoolIndex)
+		{
+			if (IsValid(GridPool[PoolIndex]) && GridPool[PoolIndex]->IsCompatible(Context.GridDimension, Context.ModelData, Context.GridSettings))
+			{
+				PooledGrid = GridPool[PoolIndex];
+				GridPool.RemoveAt(PoolIndex);
+				break;
+			}
+		}
+
+		// 그리드 생성 - 런타임에서는 NewObject 사용 가능 (Transient로 생성하여 GC 문제 방지)
+		Grid = PooledGrid ? PooledGrid : NewObject<UWFC3DGrid>(GetTransientPackage());
+		if (!Grid)
+		{
+			return nullptr;
+		}
+		InUseGrids.Add(Grid);
+	}
+
+	if (PooledGrid)
+	{
+		PooledGrid->Reset();
+		UE_LOG(LogTemp, Log, TEXT("Reusing pooled Grid - Dimension: %s"), *Context.GridDimension.ToString());
+		return PooledGrid;
+	}
+
+	if (!Grid->InitializeGridWithSettings(Context.GridDimension, Context.ModelData, Context.GridSettings))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to initialize Grid - Dimension: %s"), *Context.GridDimension.ToString());
+		FGCScopeGuard GCGuard;
+		FScopeLock GridPoolLock(&GridPoolCriticalSection);
+		InUseGrids.Remove(Grid);
+		return nullptr;
+	}
+	return Grid;
+}
+
+void UWFC3DController::ReleaseGrid(UWFC3DGrid* Grid)
+{
+	FGCScopeGuard GCGuard;
+	FScopeLock GridPoolLock(&GridPoolCriticalSection);
+	InUseGrids.Remove(Grid);
+	if (!IsValid(Grid) || Grid == GeneratedGrid || GridPool.Contains(Grid))
+	{
+		return;
+	}
+
+	if (GridPool.Num() >= MaxGridPoolSize)
+	{
+		GridPool.RemoveAt(0);
+	}
+	GridPool.Add(Grid);
+}
+
+void UWFC3DController::PublishGrid(UWFC3DGrid* Grid)
+{
+	FGCScopeGuard GCGuard;
+	FScopeLock GridPoolLock(&GridPoolCriticalSection);
+	InUseGrids.Remove(Grid);
+	GeneratedGrid = Grid;
+}
+
 FWFC3DVisualizeResult UWFC3DController::ExecuteVisualization(const FWFC3DExecutionContext& Context)
 {
 	UE_LOG(LogTemp, Log, TEXT("ExecuteVisualization started"));
@@ -0,0 +1,83 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "WFC/Data/WFC3DDomainTable.h"
+#include "WFC/Utility/WFC3DDomainUtils.h"
+
+void FWFC3DDomainTable::Initialize(const int32 InEntryWordsNum)
+{
+	EntryWordsNum = InEntryWordsNum;
+
+	Words.Reset();
+	Words.Reserve(static_cast<int64>(MaxEntriesNum) * EntryWordsNum);
+	Entropies.Reset();
+	NextInBucket.Reset();
+	HashToFirstId.Reset();
+	Intersections.Init(FIntersectionSlot(), IntersectionSlotsNum);
+	IntersectionsNum = 0;
+}
+
+FWFC3DDomainTablePtr FWFC3DDomainTable::Clone() const
+{
+	FWFC3DDomainTablePtr Table = MakeShared<FWFC3DDomainTable, ESPMode::ThreadSafe>();
+	Table->Initialize(EntryWordsNum);
+	Table->Words.Append(Words);
+	Table->Entropies = Entropies;
+	Table->NextInBucket = NextInBucket;
+	Table->HashToFirstId = HashToFirstId;
+	FMemory::Memcpy(Table->Intersections.GetData(), Intersections.GetData(), Intersections.Num() * sizeof(FIntersectionSlot));
+	Table->IntersectionsNum = IntersectionsNum;
+	return Table;
+}
+
+int32 FWFC3DDomainTable::Find(const uint64* Entry) const
+{
+	const int32* FirstId = HashToFirstId.Find(HashEntry(Entry));
+	if (FirstId == nullptr)
+	{
+		return INDEX_NONE;
+	}
+
+	for (int32 DomainId = *FirstId; DomainId != INDEX_NONE; DomainId = NextInBucket[DomainId])
+	{
+		if (FWFC3DDomainUtils::Equals(GetEntry(DomainId), Entry, EntryWordsNum))
+		{
+			return DomainId;
+		}
+	}
+	return INDEX_NONE;
+}
+
+int32 FWFC3DDomainTable::Intern(const uint64* Entry)
+{
+	const uint32 Hash = HashEntry(Entry);
+	int32* FirstId = HashToFirstId.Find(Hash);
+	if (FirstId != nullptr)
+	{
+		for (int32 DomainId = *FirstId; DomainId != INDEX_NONE; DomainId = NextInBucket[DomainId])
+		{
+			if (FWFC3DDomainUtils::Equals(GetEntry(DomainId), Entry, EntryWordsNum))
+			{
+				return DomainId;
+			}
+		}
+	}
+
+	if (Entropies.Num() >= MaxEntriesNum)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 DomainId = Entropies.Num();
+	Words.Append(Entry, EntryWordsNum);
+	Entropies.Add(FWFC3DDomainUtils::CountSetBits(Entry, EntryWordsNum));
+
+	// 같은 해시 체인의 앞에 추가
+	NextInBucket.Add(FirstId != nullptr ? *FirstId : INDEX_NONE);
+	HashToFirstId.Add(Hash, DomainId);
+	return DomainId;
+}
+
+uint32 FWFC3DDomainTable::HashEntry(const uint64* Entry) const
+{
+	return FCrc::MemCrc32(Entry, EntryWordsNum * sizeof(uint64));
+}
@@ -3,25 +3,173 @@
 #include "WFC/Data/WFC3DGrid.h"
 #include "WFC/Data/WFC3DCell.h"
 #include "WFC/Data/WFC3DModelDataAsset.h"
+#include "WFC/Utility/WFC3DCellLayoutUtils.h"
 
-void UWFC3DGrid::InitializeGrid(const FIntVector& InDimension, const UWFC3DModelDataAsset* InModelData)
+bool UWFC3DGrid::InitializeGrid(const FIntVector& InDimension, const UWFC3DModelDataAsset* InModelData)
+{
+	return InitializeGridWithSettings(InDimension, InModelData, FWFC3DGridSettings());
+}
+
+bool UWFC3DGrid::InitializeGridWithSettings(const FIntVector& InDimension, const UWFC3DModelDataAsset* InModelData, const FWFC3DGridSettings& InSettings)
 {
 	Dimension = InDimension;
-	WFC3DCells.Init(FWFC3DCell(), Dimension.X * Dimension.Y * Dimension.Z);
+	Settings = InSettings;
+	ModelData = InModelData;
+	BuildCellLayout();
+
+	TileInfosNum = InModelData->GetTileInfosNum();
+	FaceInfosNum = InModelData->GetFaceInfosNum();
+	TileWordsNum = InModelData->GetTileWordsNum();
+
+	// 붕괴된 셀의 타일 인덱스는 uint16으로 저장
+	if (TileInfosNum >= InvalidTileIndex)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Too many TileInfos: %d (Max: %d)"), TileInfosNum, InvalidTileIndex - 1);
+		ModelData = nullptr;
+		return false;
+	}
+
+	// 잘못된 경계 조건을 무시하고 제약 없는 면으로 풀지 않도록 초기화 실패 처리
+	// (ModelData를 비워 IsCompatible / Reset에서 재사용되지 않게 함)
+	if (!InitializeBoundary(InModelData))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Grid Initialization Failed - Invalid Boundary Settings"));
+		ModelData = nullptr;
+		return false;
+	}
+
+	// 초기 도메인(모든 타일 옵션 허용)을 공유 도메인 테이블의 첫 항목으로 등록
+	TArray<uint64, TInlineAllocator<16>> InitialDomain;
+	InitialDomain.SetNumZeroed(TileWordsNum);
+	FWFC3DDomainUtils::SetAll(InitialDomain.GetData(), TileWordsNum, TileInfosNum);
+	DomainTable = MakeShared<FWFC3DDomainTable, ESPMode::ThreadSafe>();
+	DomainTable->Initialize(TileWordsNum);
+	verify(DomainTable->Intern(InitialDomain.GetData()) == InitialDomainId);
+
+	Reset();
+
+	UE_LOG(LogTemp, Log, TEXT("Grid Initialized - Dimension: %s, Layout: %s, Halo: %s, Total Cells: %d, Remaining Cells: %d"),
+	       *Dimension.ToString(), *UEnum::GetValueAsString(Settings.CellLayout), Settings.bUseHaloLayer ? TEXT("True") : TEXT("False"),
+	       WFC3DCells.Num(), RemainingCells);
+	return true;
+}
+
+void UWFC3DGrid::Reset()
+{
+	if (ModelData == nullptr)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Grid is not initialized"));
+		return;
+	}
+
 	RemainingCells = Dimension.X * Dimension.Y * Dimension.Z;
- 
+
+	// 모든 셀이 초기 공유 도메인(모든 타일 옵션 허용)을 참조하므로 도메인 페이지는 쓰지 않음
+	ResetDomainPages();
+	InvalidateSupportCounts();
+	InvalidateEntropyBuckets();
+	InvalidateWeightSums();
+	PropagationWorklist.Reset();
+	BeginPropagationEpoch();
 	for (int32 Index = 0; Index < WFC3DCells.Num(); ++Index)
 	{
-		WFC3DCells[Index].Initialize(
-			InModelData->GetTileInfosNum(),
-			InModelData->GetFaceInfosNum(),
-			Index,
-			Dimension
-		);
+		WFC3DCells[Index].Initialize();
+
+		FWFC3DCellState& CellState = CellStates[Index];
+		CellState.PropagatedFaces = 0;
+
+		// Void / Halo Cell은 알고리즘에서 제외
+		if (!IsGridCell(Index))
+		{
+			continue;
+		}
+
+		CellState.Entropy = TileInfosNum;
+		CellState.TileIndex = InvalidTileIndex;
+		CellState.Flags = EWFC3DCellFlags::None;
+		SharedDomainIds[Index] = InitialDomainId;
 	}
+}
 
-	UE_LOG(LogTemp, Log, TEXT("Grid Initialized - Dimension: %s, Total Cells: %d, Remaining Cells: %d"),
-	       *Dimension.ToString(), WFC3DCells.Num(), RemainingCells);
+FWFC3DGridState UWFC3DGrid::Snapshot() const
+{
+	FWFC3DGridState State;
+	State.DomainPages = DomainPages;
+	State.PageLiveCells = PageLiveCells;
+	State.CellStates = CellStates;
+	State.SharedDomainIds = SharedDomainIds;
+	State.DomainTable = DomainTable;
+	State.RemainingCells = RemainingCells;
+	return State;
+}
+
+bool UWFC3DGrid::RestoreState(const FWFC3DGridState& State)
+{
+	if (State.CellStates.Num() != WFC3DCells.Num() || State.DomainPages.Num() != DomainPages.Num())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Grid State does not match Grid - Cells: %d / %d"), State.CellStates.Num(), WFC3DCells.Num());
+		return false;
+	}
+
+	if (!State.DomainTable.IsValid() || State.DomainTable->GetEntryWordsNum() != TileWordsNum)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Grid State domain table does not match Grid"));
+		return false;
+	}
+
+	const int64 PageWordsNum = static_cast<int64>(CellsPerPage) * TileWordsNum;
+	for (const FWFC3DDomainPagePtr& StatePage : State.DomainPages)
+	{
+		if (StatePage.IsValid() && StatePage->Words.Num() != PageWordsNum)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Grid State page size does not match Grid - Words: %d / %lld"), StatePage->Words.Num(), PageWordsNum);
+			return false;
+		}
+	}
+
+	// 도메인 페이지는 스냅샷과 공유, 이 Grid만 참조하던 페이지는 재사용을 위해 반환
+	for (int32 PageIndex = 0; PageIndex < DomainPages.Num(); ++PageIndex)
+	{
+		if (DomainPages[PageIndex] == State.DomainPages[PageIndex])
+		{
+			continue;
+		}
+		if (DomainPages[PageIndex].IsUnique())
+		{
+			FreeDomainPages.Add(DomainPages[PageIndex]);
+		}
+		SetDomainPage(PageIndex, State.DomainPages[PageIndex]);
+	}
+
+	PageLiveCells = State.PageLiveCells;
+	CellStates = State.CellStates;
+	SharedDomainIds = State.SharedDomainIds;
+	DomainTable = State.DomainTable;
+	RemainingCells = State.RemainingCells;
+	InvalidateSupportCounts();
+	InvalidateEntropyBuckets();
+	InvalidateWeightSums();
+	PropagationWorklist.Reset();
+	BeginPropagationEpoch();
+
+	// 붕괴 결과 데이터는 타일 인덱스로 다시 구성
+	for (int32 Index = 0; Index < WFC3DCells.Num(); ++Index)
+	{
+		FWFC3DCell& Cell = WFC3DCells[Index];
+		Cell.Initialize();
+		if (IsGridCell(Index) && CellStates[Index].TileIndex != InvalidTileIndex)
+		{
+			Cell.CollapsedTileInfoIndex = CellStates[Index].TileIndex;
+		}
+	}
+	return true;
+}
+
+bool UWFC3DGrid::IsCompatible(const FIntVector& InDimension, const UWFC3DModelDataAsset* InModelData, const FWFC3DGridSettings& InSettings) const
+{
+	return ModelData != nullptr && ModelData == InModelData && Dimension == InDimension &&
+		Settings.CellLayout == InSettings.CellLayout && Settings.bUseHaloLayer == InSettings.bUseHaloLayer && Settings.Boundary == InSettings.Boundary &&
+		TileInfosNum == InModelData->GetTileInfosNum() && FaceInfosNum == InModelData->GetFaceInfosNum();
 }
 
 FWFC3DCell* UWFC3DGrid::GetCell(const int32 Index)
@@ -39,7 +187,7 @@ FWFC3DCell* UWFC3DGrid::GetCell(const FIntVector& Location)
 	{
 		return nullptr;
 	}
-	return &WFC3DCells[Location.X + Location.Y * Dimension.X + Location.Z * Dimension.X * Dimension.Y];
+	return &WFC3DCells[GetCellIndex(Location)];
 }
 
 FWFC3DCell* UWFC3DGrid::GetCell(const int32 X, const int32 Y, const int32 Z)
@@ -48,7 +196,7 @@ FWFC3DCell* UWFC3DGrid::GetCell(const int32 X, const int32 Y, const int32 Z)
 	{
 		return nullptr;
 	}
-	return &WFC3DCells[X + Y * Dimension.X + Z * Dimension.X * Dimension.Y];
+	return &WFC3DCells[GetCellIndex(X, Y, Z)];
 }
 
 int32 UWFC3DGrid::GetRemainingCells() const
@@ -61,17 +209,554 @@ void UWFC3DGrid::DecreaseRemainingCells()
 	--RemainingCells;
 }
 
-bool UWFC3DGrid::IsValidLocation(const int32 Index) const
+void UWFC3DGrid::BeginPropagationEpoch()
+{
+	// Epoch가 한 바퀴 돌면 이전 단계의 값과 겹치지 않도록 모두 초기화
+	if (++PropagationEpoch == 0)
+	{
+		FMemory::Memzero(PropagatedEpochs.GetData(), PropagatedEpochs.Num() * sizeof(uint32));
+		PropagationEpoch = 1;
+	}
+}
+
+int64 UWFC3DGrid::GetSupportCountsBytes() const
+{
+	return static_cast<int64>(WFC3DCells.Num()) * 6 * TileInfosNum * static_cast<int64>(sizeof(uint16));
+}
+
+bool UWFC3DGrid::AllocateSupportCounts()
+{
+	if (!CanAllocateSupportCounts())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Support Counts too large - %lld Bytes (Max: %lld), Cells: %d, TileInfos: %d"),
+		       GetSupportCountsBytes(), MaxSupportCountsBytes, WFC3DCells.Num(), TileInfosNum);
+		return false;
+	}
+
+	const int64 SupportCountsNum = static_cast<int64>(WFC3DCells.Num()) * 6 * TileInfosNum;
+	if (SupportCounts.Num() != SupportCountsNum)
+	{
+		SupportCounts.SetNumUninitialized(SupportCountsNum);
+		UE_LOG(LogTemp, Log, TEXT("Support Counts Allocated - %lld Bytes"), SupportCountsNum * static_cast<int64>(sizeof(uint16)));
+	}
+	bSupportCountsValid = true;
+	return true;
+}
+
+FWFC3DEntropyBuckets& UWFC3DGrid::GetEntropyBuckets()
 {
-	return WFC3DCells.IsValidIndex(Index);
+	if (!bEntropyBucketsValid)
+	{
+		EntropyBuckets.Initialize(WFC3DCells.Num(), TileInfosNum);
+		for (int32 Index = 0; Index < WFC3DCells.Num(); ++Index)
+		{
+			if (IsGridCell(Index) && !IsCollapsed(Index))
+			{
+				EntropyBuckets.Add(Index, CellStates[Index].Entropy);
+			}
+		}
+		bEntropyBucketsValid = true;
+	}
+	return EntropyBuckets;
+}
+
+FWFC3DEntropyBuckets& UWFC3DGrid::GetShannonEntropyBuckets()
+{
+	if (!bWeightSumsValid)
+	{
+		const TConstArrayView<double> TileWeights = ModelData->GetTileWeights();
+		const TConstArrayView<double> TileWeightLogWeights = ModelData->GetTileWeightLogWeights();
+		const UWFC3DGrid* ConstGrid = this;
+
+		CellWeightSums.SetNumZeroed(WFC3DCells.Num());
+		ShannonEntropyBuckets.Initialize(WFC3DCells.Num(), GetMaxShannonEntropyKey());
+		bWeightSumsValid = true;
+		for (int32 Index = 0; Index < WFC3DCells.Num(); ++Index)
+		{
+			if (!IsGridCell(Index) || IsCollapsed(Index))
+			{
+				continue;
+			}
+
+			FWFC3DCellWeightSums& WeightSums = CellWeightSums[Index];
+			WeightSums = FWFC3DCellWeightSums();
+			for (const int32 TileIndex : FWFC3DDomainUtils::GetSetBits(ConstGrid->GetTileOptions(Index), TileWordsNum))
+			{
+				WeightSums.SumWeights += TileWeights[TileIndex];
+				WeightSums.SumWeightLogWeights += TileWeightLogWeights[TileIndex];
+			}
+			ShannonEntropyBuckets.Add(Index, GetShannonEntropyKey(Index));
+		}
+	}
+	return ShannonEntropyBuckets;
+}
+
+int32 UWFC3DGrid::GetShannonEntropyKey(const int32 Index) const
+{
+	const int32 TileOptionsNum = CellStates[Index].Entropy;
+	if (TileOptionsNum <= 0)
+	{
+		return 0;
+	}
+	if (TileOptionsNum == 1)
+	{
+		return 1;
+	}
+
+	// 모든 남은 타일의 가중치가 0이면 가중치 없는 Entropy(log N)를 사용
+	const FWFC3DCellWeightSums& WeightSums = CellWeightSums[Index];
+	const double ShannonEntropy = WeightSums.SumWeights > UE_SMALL_NUMBER
+		                              ? FMath::Loge(WeightSums.SumWeights) - WeightSums.SumWeightLogWeights / WeightSums.SumWeights
+		                              : FMath::Loge(static_cast<double>(TileOptionsNum));
+
+	// 가중치 합을 빼는 동안 쌓인 오차로 범위를 벗어나지 않도록 제한
+	return FMath::Clamp(1 + FMath::FloorToInt32(ShannonEntropy * ShannonEntropyBucketsPerNat), 1, GetMaxShannonEntropyKey());
+}
+
+void UWFC3DGrid::CollapseCell(const int32 Index, const int32 TileInfoIndex)
+{
+	const bool bWasCollapsed = IsCollapsed(Index);
+	SetSingleTile(Index, TileInfoIndex);
+	EnumAddFlags(CellStates[Index].Flags, EWFC3DCellFlags::Collapsed | EWFC3DCellFlags::Propagated);
+
+	WFC3DCells[Index].CollapsedTileInfoIndex = TileInfoIndex;
+	SharedDomainIds[Index] = INDEX_NONE;
+	if (bEntropyBucketsValid)
+	{
+		EntropyBuckets.Remove(Index);
+	}
+	if (bWeightSumsValid)
+	{
+		ShannonEntropyBuckets.Remove(Index);
+	}
+
+	if (!bWasCollapsed && IsGridCell(Index))
+	{
+		ReleaseCellDomain(Index);
+	}
+}
+
+void UWFC3DGrid::PrepareConcurrentWrites()
+{
+	// 작업 스레드의 도메인 / Entropy 쓰기가 버킷과 가중치 합을 고치지 않도록 무효화
+	InvalidateSupportCounts();
+	InvalidateEntropyBuckets();
+	InvalidateWeightSums();
+	for (int32 Index = 0; Index < WFC3DCells.Num(); ++Index)
+	{
+		if (IsGridCell(Index) && !IsCollapsed(Index))
+		{
+			// 쓰기용 접근으로 공유 도메인과 스냅샷 공유 페이지를 복사
+			GetTileOptions(Index);
+		}
+	}
+}
+
+void UWFC3DGrid::CollapseCellConcurrent(const int32 Index, const int32 TileInfoIndex)
+{
+	checkSlow(IsGridCell(Index) && !IsCollapsed(Index) && SharedDomainIds[Index] == INDEX_NONE);
+	SetSingleTile(Index, TileInfoIndex);
+	EnumAddFlags(CellStates[Index].Flags, EWFC3DCellFlags::Collapsed | EWFC3DCellFlags::Propagated);
+	WFC3DCells[Index].CollapsedTileInfoIndex = TileInfoIndex;
+}
+
+void UWFC3DGrid::FinishConcurrentCollapses(TConstArrayView<int32> CollapsedIndices)
+{
+	for (const int32 Index : CollapsedIndices)
+	{
+		ReleaseCellDomain(Index);
+		DecreaseRemainingCells();
+	}
 }
 
-bool UWFC3DGrid::IsValidLocation(const FIntVector& Location) const
+void UWFC3DGrid::RestoreCellConcurrent(const int32 Index, const FWFC3DCellState& State, const uint64* TileOptions)
 {
-	return Location.X >= 0 && Location.Y >= 0 && Location.Z >= 0 && Location.X < Dimension.X && Location.Y < Dimension.Y && Location.Z < Dimension.Z;
+	checkSlow(IsGridCell(Index) && State.TileIndex == InvalidTileIndex && SharedDomainIds[Index] == INDEX_NONE);
+	CellStates[Index] = State;
+	WFC3DCells[Index].CollapsedTileInfoIndex = INDEX_NONE;
+	FWFC3DDomainUtils::Copy(GetTileOptions(Index), TileOptions, TileWordsNum);
+}
+
+TArray<uint16> UWFC3DGrid::GetSolvedTiles() const
+{
+	TArray<uint16> SolvedTiles;
+	SolvedTiles.SetNumUninitialized(Dimension.X * Dimension.Y * Dimension.Z);
+
+	int32 SolvedIndex = 0;
+	for (int32 Z = 0; Z < Dimension.Z; ++Z)
+	{
+		for (int32 Y = 0; Y < Dimension.Y; ++Y)
+		{
+			for (int32 X = 0; X < Dimension.X; ++X)
+			{
+				SolvedTiles[SolvedIndex++] = CellStates[GetCellIndex(X, Y, Z)].TileIndex;
+			}
+		}
+	}
+	return SolvedTiles;
+}
+
+int32 UWFC3DGrid::GetAllocatedPagesNum() const
+{
+	int32 AllocatedPagesNum = 0;
+	for (const FWFC3DDomainPagePtr& DomainPage : DomainPages)
+	{
+		if (DomainPage.IsValid())
+		{
+			++AllocatedPagesNum;
+		}
+	}
+	return AllocatedPagesNum;
+}
+
+void UWFC3DGrid::RemoveTileWeights(const int32 Index, const uint64* NewTileOptions)
+{
+	const TConstArrayView<double> TileWeights = ModelData->GetTileWeights();
+	const TConstArrayView<double> TileWeightLogWeights = ModelData->GetTileWeightLogWeights();
+	const uint64* TileOptions = static_cast<const UWFC3DGrid*>(this)->GetTileOptions(Index);
+	FWFC3DCellWeightSums& WeightSums = CellWeightSums[Index];
+	for (int32 WordIndex = 0; WordIndex < TileWordsNum; ++WordIndex)
+	{
+		// 제거된 타일만 순회하므로 비용은 워드 수 + 제거된 타일 수
+		for (uint64 RemovedWord = TileOptions[WordIndex] & ~NewTileOptions[WordIndex]; RemovedWord != 0; RemovedWord &= RemovedWord - 1)
+		{
+			const int32 TileIndex = WordIndex * 64 + static_cast<int32>(FMath::CountTrailingZeros64(RemovedWord));
+			WeightSums.SumWeights -= TileWeights[TileIndex];
+			WeightSums.SumWeightLogWeights -= TileWeightLogWeights[TileIndex];
+		}
+	}
+}
+
+void UWFC3DGrid::RemoveTileWeight(const int32 Index, const int32 TileIndex)
+{
+	FWFC3DCellWeightSums& WeightSums = CellWeightSums[Index];
+	WeightSums.SumWeights -= ModelData->GetTileWeights()[TileIndex];
+	WeightSums.SumWeightLogWeights -= ModelData->GetTileWeightLogWeights()[TileIndex];
+}
+
+void UWFC3DGrid::SetSingleTile(const int32 Index, const int32 TileInfoIndex)
+{
+	checkf(TileInfoIndex >= 0 && TileInfoIndex < InvalidTileIndex, TEXT("TileInfoIndex %d does not fit in a collapsed cell"), TileInfoIndex);
+	CellStates[Index].TileIndex = static_cast<uint16>(TileInfoIndex);
+	CellStates[Index].Entropy = 1;
+}
+
+void UWFC3DGrid::AllocateCells(const int32 NumCells)
+{
+	WFC3DCells.Init(FWFC3DCell(), NumCells);
+	CellStates.Init(FWFC3DCellState(), NumCells);
+	SharedDomainIds.Init(INDEX_NONE, NumCells);
+	PropagationWorklist.Initialize(NumCells);
+	InvalidateEntropyBuckets();
+	InvalidateWeightSums();
+	PropagatedEpochs.Init(0, NumCells);
+	PropagationEpoch = 1;
+	DomainPages.Reset();
+	PageData.Reset();
+	PageLiveCells.Reset();
+	FreeDomainPages.Reset();
+}
+
+FWFC3DDomainTable& UWFC3DGrid::GetMutableDomainTable()
+{
+	if (!DomainTable.IsUnique())
+	{
+		DomainTable = DomainTable->Clone();
+	}
+	return *DomainTable;
+}
+
+void UWFC3DGrid::ResetDomainPages()
+{
+	const int32 PagesNum = (WFC3DCells.Num() + CellsPerPage - 1) >> CellsPerPageShift;
+	DomainPages.SetNum(PagesNum);
+	PageData.SetNumZeroed(PagesNum);
+	PageLiveCells.Init(0, PagesNum);
+
+	for (int32 Index = 0; Index < WFC3DCells.Num(); ++Index)
+	{
+		if (IsGridCell(Index))
+		{
+			++PageLiveCells[Index >> CellsPerPageShift];
+		}
+	}
+
+	// 모든 셀이 초기 공유 도메인을 참조하므로 페이지는 필요할 때 다시 할당
+	// 이 Grid만 참조하던 페이지는 재사용을 위해 반환하고, 스냅샷과 공유 중인 페이지는 참조만 해제
+	for (int32 PageIndex = 0; PageIndex < PagesNum; ++PageIndex)
+	{
+		if (DomainPages[PageIndex].IsUnique())
+		{
+			FreeDomainPages.Add(DomainPages[PageIndex]);
+		}
+		SetDomainPage(PageIndex, nullptr);
+	}
+}
+
+void UWFC3DGrid::ReleaseCellDomain(const int32 Index)
+{
+	const int32 PageIndex = Index >> CellsPerPageShift;
+	if (--PageLiveCells[PageIndex] == 0 && DomainPages[PageIndex].IsValid())
+	{
+		if (DomainPages[PageIndex].IsUnique())
+		{
+			FreeDomainPages.Add(DomainPages[PageIndex]);
+		}
+		SetDomainPage(PageIndex, nullptr);
+	}
+}
+
+FWFC3DDomainPagePtr UWFC3DGrid::AcquireDomainPage()
+{
+	if (!FreeDomainPages.IsEmpty())
+	{
+		return FreeDomainPages.Pop();
+	}
+
+	FWFC3DDomainPagePtr Page = MakeShared<FWFC3DDomainPage, ESPMode::ThreadSafe>();
+	Page->Words.SetNumUninitialized(static_cast<int64>(CellsPerPage) * TileWordsNum);
+	return Page;
+}
+
+void UWFC3DGrid::SetDomainPage(const int32 PageIndex, FWFC3DDomainPagePtr Page)
+{
+	PageData[PageIndex] = Page.IsValid() ? Page->Words.GetData() : nullptr;
+	DomainPages[PageIndex] = MoveTemp(Page);
+}
+
+void UWFC3DGrid::MakePageUnique(const int32 PageIndex)
+{
+	checkSlow(DomainPages[PageIndex].IsValid());
+	const FWFC3DDomainPagePtr SharedPage = DomainPages[PageIndex];
+	FWFC3DDomainPagePtr UniquePage = AcquireDomainPage();
+	FMemory::Memcpy(UniquePage->Words.GetData(), SharedPage->Words.GetData(), SharedPage->Words.Num() * sizeof(uint64));
+	SetDomainPage(PageIndex, MoveTemp(UniquePage));
+}
+
+void UWFC3DGrid::MakeCellDomainUnique(const int32 Index)
+{
+	const int32 PageIndex = Index >> CellsPerPageShift;
+	if (!DomainPages[PageIndex].IsValid())
+	{
+		// 페이지의 다른 셀은 공유 도메인을 참조하거나 붕괴되었으므로 내용을 초기화할 필요 없음
+		SetDomainPage(PageIndex, AcquireDomainPage());
+	}
+	else if (!DomainPages[PageIndex].IsUnique())
+	{
+		MakePageUnique(PageIndex);
+	}
+
+	FWFC3DDomainUtils::Copy(PageData[PageIndex] + static_cast<int64>(Index & (CellsPerPage - 1)) * TileWordsNum,
+	                        DomainTable->GetEntry(SharedDomainIds[Index]), TileWordsNum);
+	SharedDomainIds[Index] = INDEX_NONE;
+}
+
+void UWFC3DGrid::BuildCellLayout()
+{
+	HaloOffset = Settings.bUseHaloLayer ? 1 : 0;
+	StorageDimension = Dimension + FIntVector(2 * HaloOffset);
+	AllocateCells(FWFC3DCellLayoutUtils::GetStorageNum(StorageDimension, Settings.CellLayout));
+	FWFC3DCellLayoutUtils::BuildAxisIndexTables(StorageDimension, Settings.CellLayout, AxisIndexTables);
+	if (Settings.CellLayout == EWFC3DCellLayout::Morton)
+	{
+		FWFC3DCellLayoutUtils::BuildMortonDecodeTable(FWFC3DCellLayoutUtils::GetAxisBits(StorageDimension), MortonDecodeTable);
+	}
+	else
+	{
+		MortonDecodeTable.Reset();
+	}
+
+	// 저장 공간 밖의 셀은 Void Cell로 표시
+	for (int32 Index = 0; Index < WFC3DCells.Num(); ++Index)
+	{
+		CellStates[Index].Flags = EWFC3DCellFlags::Collapsed | EWFC3DCellFlags::Propagated | EWFC3DCellFlags::Void;
+	}
+
+	// Grid 범위 안의 셀과 Halo 셀 구분
+	for (int32 Z = 0; Z < StorageDimension.Z; ++Z)
+	{
+		for (int32 Y = 0; Y < StorageDimension.Y; ++Y)
+		{
+			for (int32 X = 0; X < StorageDimension.X; ++X)
+			{
+				const int32 Index = AxisIndexTables[0][X] + AxisIndexTables[1][Y] + AxisIndexTables[2][Z];
+				const FIntVector Location = FIntVector(X, Y, Z) - FIntVector(HaloOffset);
+				CellStates[Index].Flags = IsValidLocation(Location)
+					                   ? EWFC3DCellFlags::None
+					                   : EWFC3DCellFlags::Collapsed | EWFC3DCellFlags::Propagated | EWFC3DCellFlags::Halo;
+			}
+		}
+	}
+
+	// 이웃 테이블 구성, Void Cell과 저장 공간 밖 방향은 INDEX_NONE
+	// Grid 셀의 Grid 밖 방향은 Periodic 축이면 반대편 셀, FixedTile 면이 아니면 Halo 셀과 연결하지 않고 INDEX_NONE (경계 타일 마스크로 처리)
+	NeighbourIndices.Init(INDEX_NONE, WFC3DCells.Num() * 6);
+	for (int32 Index = 0; Index < WFC3DCells.Num(); ++Index)
+	{
+		if (IsVoid(Index))
+		{
+			continue;
+		}
+		const bool bGridCell = IsGridCell(Index);
+		for (const EFace& Direction : FWFC3DFaceUtils::AllDirections)
+		{
+			FIntVector NextLocation = GetCellLocation(Index) + FWFC3DFaceUtils::GetDirectionVector(Direction);
+			if (bGridCell && !IsValidLocation(NextLocation))
+			{
+				if (IsPeriodicAxis(Direction))
+				{
+					NextLocation = FIntVector((NextLocation.X + Dimension.X) % Dimension.X, (NextLocation.Y + Dimension.Y) % Dimension.Y,
+					                          (NextLocation.Z + Dimension.Z) % Dimension.Z);
+				}
+				else if (Settings.Boundary.GetFace(Direction).Mode != EWFC3DBoundaryMode::FixedTile)
+				{
+					continue;
+				}
+			}
+
+			const FIntVector NextStorageLocation = NextLocation + FIntVector(HaloOffset);
+			if (NextStorageLocation.X < 0 || NextStorageLocation.Y < 0 || NextStorageLocation.Z < 0 ||
+				NextStorageLocation.X >= StorageDimension.X || NextStorageLocation.Y >= StorageDimension.Y || NextStorageLocation.Z >= StorageDimension.Z)
+			{
+				continue;
+			}
+			NeighbourIndices[Index * 6 + FWFC3DFaceUtils::GetIndex(Direction)] =
+				AxisIndexTables[0][NextStorageLocation.X] + AxisIndexTables[1][NextStorageLocation.Y] + AxisIndexTables[2][NextStorageLocation.Z];
+		}
+	}
+}
+
+bool UWFC3DGrid::InitializeBoundary(const UWFC3DModelDataAsset* InModelData)
+{
+	bool bSuccess = true;
+
+	TArray<uint64, TInlineAllocator<16>> AllTileOptions;
+	AllTileOptions.SetNumZeroed(TileWordsNum);
+	FWFC3DDomainUtils::SetAll(AllTileOptions.GetData(), TileWordsNum, TileInfosNum);
+
+	// 경계 면 조건을 방향 별 경계 타일 마스크로 변환
+	BoundaryTileOptions.SetNumZeroed(6 * TileWordsNum);
+	uint32 PeriodicFaces = 0;
+	for (const EFace& Direction : FWFC3DFaceUtils::AllDirections)
+	{
+		const int32 DirectionIndex = FWFC3DFaceUtils::GetIndex(Direction);
+		const FWFC3DBoundaryFaceSpec& FaceSpec = Settings.Boundary.GetFace(Direction);
+		uint64* FaceTileOptions = BoundaryTileOptions.GetData() + DirectionIndex * TileWordsNum;
+		BoundaryFaceIndices[DirectionIndex] = INDEX_NONE;
+		FWFC3DDomainUtils::Copy(FaceTileOptions, AllTileOptions.GetData(), TileWordsNum);
+
+		if (IsPeriodicAxis(Direction))
+		{
+			if (FaceSpec.Mode != EWFC3DBoundaryMode::Periodic)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("Boundary for Direction: %s is Periodic because the opposite face is Periodic"),
+				       *UEnum::GetValueAsString(Direction));
+			}
+			PeriodicFaces |= 1u << DirectionIndex;
+			continue;
+		}
+
+		if (FaceSpec.Mode == EWFC3DBoundaryMode::FixedTile)
+		{
+			// Grid 밖의 Outer Cell 타일이 Grid 쪽 면으로 허용하는 타일 옵션
+			const FTileInfo* OuterCellTileInfo = InModelData->GetTileInfo(FaceSpec.TileIndex);
+			if (OuterCellTileInfo == nullptr)
+			{
+				UE_LOG(LogTemp, Error, TEXT("ModelData has no TileInfo at index %d"), FaceSpec.TileIndex);
+				bSuccess = false;
+				continue;
+			}
+
+			const int32 FaceIndex = OuterCellTileInfo->Faces[FWFC3DFaceUtils::GetOppositeIndex(Direction)];
+			const uint64* CompatibleTileWords = InModelData->GetCompatibleTileWords(FaceIndex);
+			if (CompatibleTileWords == nullptr)
+			{
+				UE_LOG(LogTemp, Error, TEXT("Invalid Outer Cell FaceIndex: %d for Direction: %s"), FaceIndex,
+				       *FWFC3DFaceUtils::GetDirectionVector(Direction).ToString());
+				bSuccess = false;
+				continue;
+			}
+			BoundaryFaceIndices[DirectionIndex] = FaceIndex;
+			FWFC3DDomainUtils::Copy(FaceTileOptions, CompatibleTileWords, TileWordsNum);
+		}
+		else if (FaceSpec.Mode == EWFC3DBoundaryMode::AllowedTiles)
+		{
+			FWFC3DDomainUtils::Clear(FaceTileOptions, TileWordsNum);
+			for (const int32 TileIndex : FaceSpec.AllowedTileIndices)
+			{
+				if (TileIndex < 0 || TileIndex >= TileInfosNum)
+				{
+					UE_LOG(LogTemp, Warning, TEXT("Invalid Allowed TileIndex: %d for Direction: %s"), TileIndex, *UEnum::GetValueAsString(Direction));
+					continue;
+				}
+				FWFC3DDomainUtils::SetBit(FaceTileOptions, TileIndex);
+			}
+			if (FWFC3DDomainUtils::IsZero(FaceTileOptions, TileWordsNum))
+			{
+				UE_LOG(LogTemp, Error, TEXT("No Allowed Tiles for Direction: %s"), *UEnum::GetValueAsString(Direction));
+				bSuccess = false;
+			}
+		}
+	}
+
+	// Halo 셀은 닿아 있는 FixedTile 면의 Outer Cell 타일로 붕괴된 상태 (Grid 셀과 연결되지 않는 Halo 셀은 0번)
+	for (int32 Index = 0; Index < WFC3DCells.Num(); ++Index)
+	{
+		if (!IsHalo(Index))
+		{
+			continue;
+		}
+		int32 HaloTileIndex = 0;
+		for (const EFace& Direction : FWFC3DFaceUtils::AllDirections)
+		{
+			const FWFC3DBoundaryFaceSpec& FaceSpec = Settings.Boundary.GetFace(Direction);
+			if (FaceSpec.Mode == EWFC3DBoundaryMode::FixedTile && BoundaryFaceIndices[FWFC3DFaceUtils::GetIndex(Direction)] != INDEX_NONE &&
+				IsValidLocation(GetCellLocation(Index) - FWFC3DFaceUtils::GetDirectionVector(Direction)))
+			{
+				HaloTileIndex = FaceSpec.TileIndex;
+				break;
+			}
+		}
+		SetSingleTile(Index, HaloTileIndex);
+	}
+
+	// 모든 타일을 허용하지 않는 경계 면에 닿은 외곽 셀 목록
+	bool bConstrainedFaces[6];
+	for (const EFace& Direction : FWFC3DFaceUtils::AllDirections)
+	{
+		bConstrainedFaces[FWFC3DFaceUtils::GetIndex(Direction)] =
+			!FWFC3DDomainUtils::Equals(GetBoundaryTileOptions(Direction), AllTileOptions.GetData(), TileWordsNum);
+	}
+	BoundaryShellCells.Reset();
+	BoundaryShellFaces.Reset();
+	for (int32 Index = 0; Index < WFC3DCells.Num(); ++Index)
+	{
+		if (!IsGridCell(Index))
+		{
+			continue;
+		}
+		uint8 ShellFaces = 0;
+		for (const EFace& Direction : FWFC3DFaceUtils::AllDirections)
+		{
+			const int32 DirectionIndex = FWFC3DFaceUtils::GetIndex(Direction);
+			if (GetNeighbourIndex(Index, Direction) == INDEX_NONE && bConstrainedFaces[DirectionIndex])
+			{
+				ShellFaces |= 1 << DirectionIndex;
+			}
+		}
+		if (ShellFaces != 0)
+		{
+			BoundaryShellCells.Add(Index);
+			BoundaryShellFaces.Add(ShellFaces);
+		}
+	}
+
+	BoundaryHash = FCrc::MemCrc32(BoundaryTileOptions.GetData(), BoundaryTileOptions.Num() * sizeof(uint64), PeriodicFaces);
+	return bSuccess;
 }
 
-bool UWFC3DGrid::IsValidLocation(const int32 X, const int32 Y, const int32 Z) const
+bool UWFC3DGrid::IsPeriodicAxis(const EFace Direction) const
 {
-	return X >= 0 && X < Dimension.X && Y >= 0 && Y < Dimension.Y && Z >= 0 && Z < Dimension.Z;
+	return Settings.Boundary.GetFace(Direction).Mode == EWFC3DBoundaryMode::Periodic ||
+		Settings.Boundary.GetFace(FWFC3DFaceUtils::GetOpposite(Direction)).Mode == EWFC3DBoundaryMode::Periodic;
 }
@@ -0,0 +1,117 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "WFC/Data/WFC3DGridStateCache.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "WFC/Data/WFC3DGrid.h"
+#include "WFC/Data/WFC3DModelDataAsset.h"
+
+namespace
+{
+	struct FGridStateCacheKey
+	{
+		uint32 ModelDataHash = 0;
+		FIntVector Dimension = FIntVector::ZeroValue;
+		EWFC3DCellLayout CellLayout = EWFC3DCellLayout::RowMajor;
+		bool bUseHaloLayer = false;
+		uint32 BoundaryHash = 0;
+
+		bool operator==(const FGridStateCacheKey& Other) const
+		{
+			return ModelDataHash == Other.ModelDataHash && Dimension == Other.Dimension &&
+				CellLayout == Other.CellLayout && bUseHaloLayer == Other.bUseHaloLayer && BoundaryHash == Other.BoundaryHash;
+		}
+	};
+
+	using FGridStatePtr = TSharedPtr<const FWFC3DGridState, ESPMode::ThreadSafe>;
+
+	struct FGridStateCacheEntry
+	{
+		FGridStateCacheKey Key;
+		FGridStatePtr State;
+	};
+
+	/** 알고리즘은 백그라운드 스레드에서도 실행되므로 캐시 접근은 잠금으로 보호 */
+	FCriticalSection GridStateCacheLock;
+	TArray<FGridStateCacheEntry> GridStateCacheEntries;
+
+	/**
+	 * Grid의 캐시 키를 만듭니다.
+	 * @return ModelData가 없거나 알고리즘 데이터가 초기화되지 않았으면 false
+	 */
+	bool MakeCacheKey(const UWFC3DGrid* Grid, FGridStateCacheKey& OutKey)
+	{
+		if (Grid == nullptr || Grid->GetModelData() == nullptr || Grid->GetModelData()->GetAlgorithmDataHash() == 0)
+		{
+			return false;
+		}
+		OutKey.ModelDataHash = Grid->GetModelData()->GetAlgorithmDataHash();
+		OutKey.Dimension = Grid->GetDimension();
+		OutKey.CellLayout = Grid->GetSettings().CellLayout;
+		OutKey.bUseHaloLayer = Grid->GetSettings().bUseHaloLayer;
+		OutKey.BoundaryHash = Grid->GetBoundaryHash();
+		return true;
+	}
+
+	FGridStatePtr FindState(const FGridStateCacheKey& Key)
+	{
+		FScopeLock Lock(&GridStateCacheLock);
+		for (const FGridStateCacheEntry& Entry : GridStateCacheEntries)
+		{
+			if (Entry.Key == Key)
+			{
+				return Entry.State;
+			}
+		}
+		return nullptr;
+	}
+
+	FAutoConsoleCommand ClearGridStateCacheCommand(
+		TEXT("WFC3D.ClearGridStateCache"),
+		TEXT("캐시된 초기 전파 이후 Grid 상태를 모두 제거합니다."),
+		FConsoleCommandDelegate::CreateStatic(&FWFC3DGridStateCache::Clear));
+}
+
+bool FWFC3DGridStateCache::RestoreInitialState(UWFC3DGrid* Grid)
+{
+	FGridStateCacheKey Key;
+	if (!MakeCacheKey(Grid, Key))
+	{
+		return false;
+	}
+
+	// 복원은 잠금 밖에서 수행, 캐시에서 제거되어도 State는 유지됨
+	const FGridStatePtr State = FindState(Key);
+	if (!State.IsValid())
+	{
+		return false;
+	}
+	return Grid->RestoreState(*State);
+}
+
+void FWFC3DGridStateCache::StoreInitialState(const UWFC3DGrid* Grid)
+{
+	FGridStateCacheKey Key;
+	if (!MakeCacheKey(Grid, Key) || FindState(Key).IsValid())
+	{
+		return;
+	}
+
+	// 도메인 페이지는 Grid와 공유되며, Grid가 이후에 쓰는 페이지만 복사됨
+	const FGridStatePtr State = MakeShared<FWFC3DGridState, ESPMode::ThreadSafe>(Grid->Snapshot());
+
+	FScopeLock Lock(&GridStateCacheLock);
+	if (GridStateCacheEntries.Num() >= MaxEntriesNum)
+	{
+		GridStateCacheEntries.RemoveAt(0);
+	}
+	GridStateCacheEntries.Add({Key, State});
+
+	UE_LOG(LogTemp, Log, TEXT("Initial Grid State cached - Dimension: %s, ModelData Hash: %08x"), *Key.Dimension.ToString(), Key.ModelDataHash);
+}
+
+void FWFC3DGridStateCache::Clear()
+{
+	FScopeLock Lock(&GridStateCacheLock);
+	GridStateCacheEntries.Empty();
+}
@@ -3,6 +3,8 @@
 
 #include "WFC/Data/WFC3DModelDataAsset.h"
 #include "WFC/Data/WFC3DFaceUtils.h"
+#include "WFC/Utility/WFC3DDomainUtils.h"
+#include "WFC/Utility/WFC3DWeightedSampler.h"
 
 
 bool UWFC3DModelDataAsset::InitializeData()
@@ -131,6 +133,23 @@ const TBitArray<>* UWFC3DModelDataAsset::GetCompatibleTiles(const int32 FaceInde
 	return &FaceToTileBitArrays[FaceIndex];
 }
 
+const uint64* UWFC3DModelDataAsset::GetCompatibleTileWords(const int32 FaceIndex) const
+{
+	if (FaceToTileWords.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("FaceToTileWords is Empty"));
+		return nullptr;
+	}
+
+	if (FaceIndex < 0 || FaceIndex >= FaceInfos.Num())
+	{
+		UE_LOG(LogTemp, Error, TEXT("FaceIndex is Out of Range"));
+		return nullptr;
+	}
+
+	return FaceToTileWords.GetData() + FaceIndex * TileWordsNum;
+}
+
 const TArray<int32>* UWFC3DModelDataAsset::GetTileFaceIndices(const int32 TileIndex) const
 {
 	if (TileInfos.IsEmpty())
@@ -445,6 +464,99 @@ bool UWFC3DModelDataAsset::InitializeFaceToTile()
 		FaceToTileBitArrays.Add(NewBitArray);
 		FaceToTileBitStrings.Add(MoveTemp(NewBitArray));
 	}
+
+	return InitializeFaceToTileWords();
+}
+
+bool UWFC3DModelDataAsset::InitializeFaceToTileWords()
+{
+	if (FaceToTileBitArrays.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("FaceToTileBitArrays is Empty"));
+		return false;
+	}
+
+	// 고정 크기 도메인 인스턴스에 맞게 워드 수 정렬
+	TileWordsNum = FWFC3DDomainUtils::GetAlignedWordsNum(TileInfos.Num());
+	FaceWordsNum = FWFC3DDomainUtils::GetWordsNum(FaceInfos.Num());
+
+	FaceToTileWords.SetNumZeroed(FaceToTileBitArrays.Num() * TileWordsNum);
+	for (int32 FaceIndex = 0; FaceIndex < FaceToTileBitArrays.Num(); ++FaceIndex)
+	{
+		FWFC3DDomainUtils::FromBitArray(FaceToTileBitArrays[FaceIndex], FaceToTileWords.GetData() + FaceIndex * TileWordsNum, TileWordsNum);
+	}
+
+	// 타일의 면 구성과 면 호환 테이블이 같으면 전파 결과도 같음
+	AlgorithmDataHash = HashCombine(GetTypeHash(TileInfos.Num()), GetTypeHash(FaceInfos.Num()));
+	for (const FTileInfo& TileInfo : TileInfos)
+	{
+		for (const int32 FaceIndex : TileInfo.Faces)
+		{
+			AlgorithmDataHash = HashCombine(AlgorithmDataHash, GetTypeHash(FaceIndex));
+		}
+	}
+	AlgorithmDataHash = FCrc::MemCrc32(FaceToTileWords.GetData(), FaceToTileWords.Num() * sizeof(uint64), AlgorithmDataHash);
+	return InitializePropagatorTable() && InitializeTileWeightTable();
+}
+
+bool UWFC3DModelDataAsset::InitializePropagatorTable()
+{
+	if (OppositeFaceIndices.Num() != FaceInfos.Num())
+	{
+		UE_LOG(LogTemp, Error, TEXT("OppositeFaceIndices Size: %d does not match FaceInfos Size: %d"), OppositeFaceIndices.Num(), FaceInfos.Num());
+		return false;
+	}
+
+	/** 면 클래스: 면 별 해당 면을 가진 타일 집합 */
+	FaceClassTileWords.SetNumZeroed(FaceInfos.Num() * TileWordsNum);
+	for (TArray<int32>& FaceIndices : DirectionFaceIndices)
+	{
+		FaceIndices.Reset();
+	}
+	for (int32 FaceIndex = 0; FaceIndex < FaceInfos.Num(); ++FaceIndex)
+	{
+		DirectionFaceIndices[FWFC3DFaceUtils::GetIndex(FaceInfos[FaceIndex].Direction)].Add(FaceIndex);
+	}
+	for (int32 TileIndex = 0; TileIndex < TileInfos.Num(); ++TileIndex)
+	{
+		for (const int32 FaceIndex : TileInfos[TileIndex].Faces)
+		{
+			FWFC3DDomainUtils::SetBit(FaceClassTileWords.GetData() + FaceIndex * TileWordsNum, TileIndex);
+		}
+	}
+
+	/** Compatible[Tile][Direction]: Direction 방향 면의 반대 면을 가진 타일 집합 */
+	TileCompatibleWords.SetNumZeroed(TileInfos.Num() * 6 * TileWordsNum);
+	for (int32 TileIndex = 0; TileIndex < TileInfos.Num(); ++TileIndex)
+	{
+		for (const EFace& Direction : FWFC3DFaceUtils::AllDirections)
+		{
+			const int32 OppositeFaceIndex = OppositeFaceIndices[TileInfos[TileIndex].Faces[FWFC3DFaceUtils::GetIndex(Direction)]];
+			FWFC3DDomainUtils::Copy(TileCompatibleWords.GetData() + (TileIndex * 6 + FWFC3DFaceUtils::GetIndex(Direction)) * TileWordsNum,
+			                        GetFaceClassTileWords(OppositeFaceIndex), TileWordsNum);
+		}
+	}
+	return true;
+}
+
+bool UWFC3DModelDataAsset::InitializeTileWeightTable()
+{
+	TileWeights.SetNumUninitialized(TileInfos.Num());
+	TileWeightLogWeights.SetNumUninitialized(TileInfos.Num());
+	for (int32 TileIndex = 0; TileIndex < TileInfos.Num(); ++TileIndex)
+	{
+		const double Weight = FMath::Max(static_cast<double>(TileInfos[TileIndex].Weight), 0.0);
+		TileWeights[TileIndex] = Weight;
+		TileWeightLogWeights[TileIndex] = Weight > 0.0 ? Weight * FMath::Loge(Weight) : 0.0;
+	}
+
+	/** 샘플링용 가중치: 도메인 워드의 비트 위치와 같은 배치 */
+	TileSampleWeights.SetNumZeroed(TileWordsNum * FWFC3DDomainUtils::BitsPerWord);
+	for (int32 TileIndex = 0; TileIndex < TileInfos.Num(); ++TileIndex)
+	{
+		TileSampleWeights[TileIndex] = static_cast<float>(TileWeights[TileIndex]);
+	}
+	FWFC3DWeightedSampler::BuildAliasTable(TileWeights, TileAliasProbabilities, TileAliasIndices);
 	return true;
 }
 
@@ -496,7 +608,7 @@ bool UWFC3DModelDataAsset::LoadFaceToTileBitArrays()
 		TBitArray<> BitArray = BitString.GetBitArray();
 		FaceToTileBitArrays.Add(BitArray);
 	}
-	return true;
+	return InitializeFaceToTileWords();
 }
 
 FTileInfo UWFC3DModelDataAsset::RotateTileClockwise(const FTileInfo& TileToRotate, const int32 RotationStep)
@@ -72,7 +72,11 @@ void AWFC3DAsyncExample::ExecuteAsync()
 
 	// 테스트용 Grid 생성 및 초기화
 	UWFC3DGrid* TestGrid = NewObject<UWFC3DGrid>();
-	TestGrid->InitializeGrid({TestGridSize.X, TestGridSize.Y, TestGridSize.Z}, TestModelData);
+	if (!TestGrid->InitializeGrid({TestGridSize.X, TestGridSize.Y, TestGridSize.Z}, TestModelData))
+	{
+		UE_LOG(LogTemp, Error, TEXT("TestGrid initialization failed"));
+		return;
+	}
 
 	// 컨텍스트 생성
 	FWFC3DAlgorithmContext TestContext(TestGrid, TestModelData);
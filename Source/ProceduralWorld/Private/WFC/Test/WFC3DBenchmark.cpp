@@ -0,0 +1,325 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/Package.h"
+#include "WFC/Algorithm/WFC3DAlgorithm.h"
+#include "WFC/Data/WFC3DFaceUtils.h"
+#include "WFC/Data/WFC3DGrid.h"
+#include "WFC/Data/WFC3DModelDataAsset.h"
+
+/**
+ * WFC3D 성능 측정 함수 모음
+ * 콘솔 명령어로 실행하며 결과는 LogTemp에 출력됩니다.
+ */
+namespace WFC3DBenchmark
+{
+	/** 캐시 시뮬레이션: 32KB Direct-Mapped L1, 64 Byte Line */
+	constexpr int32 CacheLineBytes = 64;
+	constexpr int32 CacheLinesNum = 512;
+
+	struct FLayoutBenchmarkResult
+	{
+		double ElapsedMilliseconds = 0.0;
+		int64 NeighbourAccesses = 0;
+		int64 SimulatedCacheMisses = 0;
+		double AverageNeighbourDistanceBytes = 0.0;
+	};
+
+	/**
+	 * Layout으로 초기화한 Grid에서 중앙 셀부터 BFS로 모든 셀을 방문하며 6방향 이웃의 도메인을 읽습니다.
+	 * PropagateCell처럼 GetNeighbourIndex의 이웃 테이블과 도메인 페이지(GetTileOptions)를 그대로 사용하고,
+	 * 셀 간격은 ModelData의 타일 수로 정해지는 GetTileWordsNum 워드입니다.
+	 */
+	FLayoutBenchmarkResult RunLayoutBFS(const UWFC3DModelDataAsset* ModelData, const FIntVector& Dimension, const EWFC3DCellLayout Layout)
+	{
+		FLayoutBenchmarkResult Result;
+
+		FWFC3DGridSettings Settings;
+		Settings.CellLayout = Layout;
+		UWFC3DGrid* Grid = NewObject<UWFC3DGrid>(GetTransientPackage());
+		if (!Grid->InitializeGridWithSettings(Dimension, ModelData, Settings))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Benchmark Grid initialization failed - Dimension: %s"), *Dimension.ToString());
+			return Result;
+		}
+
+		// 초기 상태의 셀은 공유 도메인을 참조하므로, 전파 중처럼 모든 셀이 도메인 페이지에 자신의 도메인을 가지도록 함
+		Grid->PrepareConcurrentWrites();
+		const UWFC3DGrid* ConstGrid = Grid;
+		const int32 TileWordsNum = Grid->GetTileWordsNum();
+		const int64 CellStrideBytes = static_cast<int64>(TileWordsNum) * sizeof(uint64);
+
+		TBitArray<> Visited(false, Grid->Num());
+		TArray<int32> Queue;
+		Queue.Reserve(Dimension.X * Dimension.Y * Dimension.Z);
+
+		TArray<int64> CacheTags;
+		CacheTags.Init(INDEX_NONE, CacheLinesNum);
+
+		const int32 CenterIndex = Grid->GetCellIndex(Dimension / 2);
+		Queue.Add(CenterIndex);
+		Visited[CenterIndex] = true;
+
+		uint64 Accumulated = ~uint64(0);
+		int64 TotalDistance = 0;
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 QueueHead = 0; QueueHead < Queue.Num(); ++QueueHead)
+		{
+			const int32 CellIndex = Queue[QueueHead];
+			for (const EFace& Direction : FWFC3DFaceUtils::AllDirections)
+			{
+				const int32 NextIndex = Grid->GetNeighbourIndex(CellIndex, Direction);
+				if (NextIndex == INDEX_NONE || !Grid->IsGridCell(NextIndex))
+				{
+					continue;
+				}
+
+				const uint64* NextTileOptions = ConstGrid->GetTileOptions(NextIndex);
+				for (int32 WordIndex = 0; WordIndex < TileWordsNum; ++WordIndex)
+				{
+					Accumulated &= NextTileOptions[WordIndex];
+				}
+
+				++Result.NeighbourAccesses;
+				TotalDistance += FMath::Abs(static_cast<int64>(NextIndex) - CellIndex) * CellStrideBytes;
+
+				// 도메인이 걸친 모든 캐시 라인을 실제 주소로 시뮬레이션
+				const int64 FirstCacheLine = static_cast<int64>(reinterpret_cast<UPTRINT>(NextTileOptions) / CacheLineBytes);
+				const int64 LastCacheLine = static_cast<int64>((reinterpret_cast<UPTRINT>(NextTileOptions) + CellStrideBytes - 1) / CacheLineBytes);
+				for (int64 CacheLine = FirstCacheLine; CacheLine <= LastCacheLine; ++CacheLine)
+				{
+					int64& CacheTag = CacheTags[CacheLine % CacheLinesNum];
+					if (CacheTag != CacheLine)
+					{
+						CacheTag = CacheLine;
+						++Result.SimulatedCacheMisses;
+					}
+				}
+
+				if (!Visited[NextIndex])
+				{
+					Visited[NextIndex] = true;
+					Queue.Add(NextIndex);
+				}
+			}
+		}
+		Result.ElapsedMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		Result.AverageNeighbourDistanceBytes = Result.NeighbourAccesses > 0
+			                                       ? static_cast<double>(TotalDistance) / Result.NeighbourAccesses
+			                                       : 0.0;
+
+		// 최적화로 루프가 제거되지 않도록 결과 사용
+		if (Accumulated == 0)
+		{
+			UE_LOG(LogTemp, Verbose, TEXT("Benchmark accumulator is zero"));
+		}
+		return Result;
+	}
+
+	/**
+	 * RowMajor / Morton 셀 레이아웃의 BFS 이웃 접근 비용 비교 (32³ ~ 128³)
+	 * 인자: ModelData 에셋 경로 (도메인 크기를 정함)
+	 */
+	void BenchmarkCellLayout(const TArray<FString>& Args)
+	{
+		if (Args.Num() < 1)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Usage: WFC3D.Benchmark.CellLayout <ModelDataPath>"));
+			return;
+		}
+
+		const UWFC3DModelDataAsset* ModelData = LoadObject<UWFC3DModelDataAsset>(nullptr, *Args[0]);
+		if (ModelData == nullptr)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to load ModelData: %s"), *Args[0]);
+			return;
+		}
+
+		UE_LOG(LogTemp, Warning, TEXT("=== WFC3D Cell Layout Benchmark (%s) ==="), *ModelData->GetName());
+
+		for (const int32 Size : {32, 64, 128})
+		{
+			const FIntVector Dimension(Size, Size, Size);
+			for (const EWFC3DCellLayout Layout : {EWFC3DCellLayout::RowMajor, EWFC3DCellLayout::Morton})
+			{
+				const FLayoutBenchmarkResult Result = RunLayoutBFS(ModelData, Dimension, Layout);
+				UE_LOG(LogTemp, Log, TEXT("  %3d^3 %-10s: %8.2f ms, Neighbour Accesses: %lld, Simulated L1 Misses: %lld (%.1f%%), Avg Neighbour Distance: %.0f B"),
+				       Size,
+				       *UEnum::GetDisplayValueAsText(Layout).ToString(),
+				       Result.ElapsedMilliseconds,
+				       Result.NeighbourAccesses,
+				       Result.SimulatedCacheMisses,
+				       Result.NeighbourAccesses > 0 ? 100.0 * Result.SimulatedCacheMisses / Result.NeighbourAccesses : 0.0,
+				       Result.AverageNeighbourDistanceBytes);
+			}
+		}
+
+		UE_LOG(LogTemp, Warning, TEXT("=== WFC3D Cell Layout Benchmark 완료 ==="));
+	}
+
+	static FAutoConsoleCommand BenchmarkCellLayoutCommand(
+		TEXT("WFC3D.Benchmark.CellLayout"),
+		TEXT("RowMajor / Morton 셀 레이아웃의 BFS 전파 접근 비용을 실제 Grid로 비교합니다. (32^3 ~ 128^3) <ModelDataPath>"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkCellLayout));
+
+	struct FGenerationBenchmarkResult
+	{
+		double ElapsedMilliseconds = 0.0;
+		int32 SucceededRuns = 0;
+		int32 TotalAttempts = 0;
+	};
+
+	/**
+	 * Algorithm으로 RunsNum번 생성하며, 각 생성은 Controller처럼 Grid를 Reset하고 시드를 바꿔 성공할 때까지 재시도합니다.
+	 * 시드는 실행 / 시도 번호로 정해지므로 비교하는 전략 사이에 같은 시드 순서를 사용합니다.
+	 */
+	FGenerationBenchmarkResult RunGenerations(UWFC3DAlgorithm* Algorithm, const UWFC3DModelDataAsset* ModelData, const FIntVector& Dimension,
+	                                          const int32 RunsNum, const int32 MaxAttempts)
+	{
+		FGenerationBenchmarkResult Result;
+
+		UWFC3DGrid* Grid = NewObject<UWFC3DGrid>(GetTransientPackage());
+		if (!Grid->InitializeGrid(Dimension, ModelData))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Benchmark Grid initialization failed - Dimension: %s"), *Dimension.ToString());
+			return Result;
+		}
+		const FWFC3DAlgorithmContext Context(Grid, ModelData);
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Run = 0; Run < RunsNum; ++Run)
+		{
+			for (int32 Attempt = 1; Attempt <= MaxAttempts; ++Attempt)
+			{
+				Grid->Reset();
+				Algorithm->Seed = Run * MaxAttempts + Attempt;
+				++Result.TotalAttempts;
+				if (Algorithm->Execute(Context).bSuccess)
+				{
+					++Result.SucceededRuns;
+					break;
+				}
+			}
+		}
+		Result.ElapsedMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		return Result;
+	}
+
+	/** 생성 벤치마크 콘솔 명령의 공통 인자 */
+	struct FGenerationBenchmarkArgs
+	{
+		const UWFC3DModelDataAsset* ModelData = nullptr;
+		FIntVector Dimension = FIntVector::ZeroValue;
+		int32 RunsNum = 10;
+		int32 MaxAttempts = 20;
+	};
+
+	/**
+	 * 생성 벤치마크 콘솔 명령의 인자를 읽고 ModelData를 불러온 뒤 벤치마크 시작 로그를 남깁니다.
+	 * 인자: ModelData 에셋 경로, Grid 크기 (기본 16), 생성 횟수 (기본 10), 생성 당 최대 시도 횟수 (기본 20)
+	 * @return 인자가 부족하거나 ModelData를 불러오지 못하면 false
+	 */
+	bool ParseGenerationBenchmarkArgs(const TArray<FString>& Args, const TCHAR* CommandName, const TCHAR* BenchmarkName, FGenerationBenchmarkArgs& OutArgs)
+	{
+		if (Args.Num() < 1)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Usage: %s <ModelDataPath> [Size=16] [Runs=10] [MaxAttempts=20]"), CommandName);
+			return false;
+		}
+
+		OutArgs.ModelData = LoadObject<UWFC3DModelDataAsset>(nullptr, *Args[0]);
+		if (OutArgs.ModelData == nullptr)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to load ModelData: %s"), *Args[0]);
+			return false;
+		}
+
+		const int32 Size = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 16;
+		OutArgs.Dimension = FIntVector(Size, Size, Size);
+		OutArgs.RunsNum = Args.Num() > 2 ? FMath::Max(FCString::Atoi(*Args[2]), 1) : 10;
+		OutArgs.MaxAttempts = Args.Num() > 3 ? FMath::Max(FCString::Atoi(*Args[3]), 1) : 20;
+
+		UE_LOG(LogTemp, Warning, TEXT("=== WFC3D %s Benchmark (%s, %d^3, Runs: %d, Max Attempts: %d) ==="),
+		       BenchmarkName, *OutArgs.ModelData->GetName(), Size, OutArgs.RunsNum, OutArgs.MaxAttempts);
+		return true;
+	}
+
+	/** 전파 방식으로 RunsNum번 생성합니다. */
+	FGenerationBenchmarkResult RunPropagationMethod(const UWFC3DModelDataAsset* ModelData, const FIntVector& Dimension,
+	                                                const EPropagationMethod Method, const int32 RunsNum, const int32 MaxAttempts)
+	{
+		UWFC3DAlgorithm* Algorithm = NewObject<UWFC3DAlgorithm>(GetTransientPackage());
+		Algorithm->PropagationStrategy.PropagationMethod = Method;
+		return RunGenerations(Algorithm, ModelData, Dimension, RunsNum, MaxAttempts);
+	}
+
+	/**
+	 * 전파 방식 별 성공까지의 재시도 횟수와 전체 시간 비교
+	 * 인자는 ParseGenerationBenchmarkArgs 참고
+	 */
+	void BenchmarkPropagationMethod(const TArray<FString>& Args)
+	{
+		FGenerationBenchmarkArgs BenchmarkArgs;
+		if (!ParseGenerationBenchmarkArgs(Args, TEXT("WFC3D.Benchmark.Propagation"), TEXT("Propagation"), BenchmarkArgs))
+		{
+			return;
+		}
+
+		for (const EPropagationMethod Method : {EPropagationMethod::DomainIntersection, EPropagationMethod::Fixpoint, EPropagationMethod::ParallelFixpoint, EPropagationMethod::SupportCounting})
+		{
+			const FGenerationBenchmarkResult Result = RunPropagationMethod(BenchmarkArgs.ModelData, BenchmarkArgs.Dimension, Method, BenchmarkArgs.RunsNum, BenchmarkArgs.MaxAttempts);
+			UE_LOG(LogTemp, Log, TEXT("  %-24s: %10.2f ms, Succeeded: %d / %d, Attempts: %d (%.2f per Run), %.2f ms per Attempt"),
+			       *UEnum::GetDisplayValueAsText(Method).ToString(),
+			       Result.ElapsedMilliseconds,
+			       Result.SucceededRuns, BenchmarkArgs.RunsNum,
+			       Result.TotalAttempts,
+			       static_cast<double>(Result.TotalAttempts) / BenchmarkArgs.RunsNum,
+			       Result.TotalAttempts > 0 ? Result.ElapsedMilliseconds / Result.TotalAttempts : 0.0);
+		}
+
+		UE_LOG(LogTemp, Warning, TEXT("=== WFC3D Propagation Benchmark 완료 ==="));
+	}
+
+	static FAutoConsoleCommand BenchmarkPropagationCommand(
+		TEXT("WFC3D.Benchmark.Propagation"),
+		TEXT("전파 방식(Domain Intersection / Fixpoint / Parallel Fixpoint / Support Counting) 별 성공까지의 재시도 횟수와 전체 시간을 비교합니다. <ModelDataPath> [Size] [Runs] [MaxAttempts]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkPropagationMethod));
+
+	/**
+	 * 셀 선택 전략 별 생성 성공률과 성공까지의 시간 비교
+	 * 인자는 ParseGenerationBenchmarkArgs 참고
+	 */
+	void BenchmarkCellSelectStrategy(const TArray<FString>& Args)
+	{
+		FGenerationBenchmarkArgs BenchmarkArgs;
+		if (!ParseGenerationBenchmarkArgs(Args, TEXT("WFC3D.Benchmark.CellSelect"), TEXT("Cell Select"), BenchmarkArgs))
+		{
+			return;
+		}
+
+		for (const ECollapseCellSelectStrategy Strategy : {ECollapseCellSelectStrategy::ByEntropy, ECollapseCellSelectStrategy::ByShannonEntropy})
+		{
+			UWFC3DAlgorithm* Algorithm = NewObject<UWFC3DAlgorithm>(GetTransientPackage());
+			Algorithm->CollapseStrategy.CellSelectStrategy = Strategy;
+			const FGenerationBenchmarkResult Result = RunGenerations(Algorithm, BenchmarkArgs.ModelData, BenchmarkArgs.Dimension, BenchmarkArgs.RunsNum, BenchmarkArgs.MaxAttempts);
+
+			// 시도 당 성공률은 재시도 없이 한 번에 생성될 확률, 생성 당 시간은 재시도를 포함한 성공까지의 시간
+			UE_LOG(LogTemp, Log, TEXT("  %-20s: %10.2f ms, Succeeded: %d / %d, Attempt Success Rate: %.1f%%, %.2f ms per Run"),
+			       *UEnum::GetDisplayValueAsText(Strategy).ToString(),
+			       Result.ElapsedMilliseconds,
+			       Result.SucceededRuns, BenchmarkArgs.RunsNum,
+			       Result.TotalAttempts > 0 ? 100.0 * Result.SucceededRuns / Result.TotalAttempts : 0.0,
+			       Result.ElapsedMilliseconds / BenchmarkArgs.RunsNum);
+		}
+
+		UE_LOG(LogTemp, Warning, TEXT("=== WFC3D Cell Select Benchmark 완료 ==="));
+	}
+
+	static FAutoConsoleCommand BenchmarkCellSelectCommand(
+		TEXT("WFC3D.Benchmark.CellSelect"),
+		TEXT("셀 선택 전략(By Entropy / By Shannon Entropy) 별 생성 성공률과 성공까지의 시간을 비교합니다. <ModelDataPath> [Size] [Runs] [MaxAttempts]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkCellSelectStrategy));
+}
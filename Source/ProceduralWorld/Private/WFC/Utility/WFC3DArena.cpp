@@ -0,0 +1,91 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "WFC/Utility/WFC3DArena.h"
+
+namespace
+{
+	/** 현재 스레드에서 사용 중인 Arena (FWFC3DArenaScope로 설정) */
+	thread_local FWFC3DArena* CurrentWFC3DArena = nullptr;
+}
+
+FWFC3DArena::FWFC3DArena(const int64 InBlockSize)
+	: BlockSize(FMath::Max<int64>(InBlockSize, 1024))
+{
+}
+
+FWFC3DArena::~FWFC3DArena()
+{
+	for (const FBlock& Block : Blocks)
+	{
+		FMemory::Free(Block.Data);
+	}
+}
+
+void* FWFC3DArena::Allocate(const SIZE_T Size, const uint32 Alignment)
+{
+	++AllocationCount;
+
+	// 현재 블록부터 공간이 남은 블록을 찾음
+	while (CurrentBlockIndex < Blocks.Num())
+	{
+		const FBlock& Block = Blocks[CurrentBlockIndex];
+		const UPTRINT BlockStart = reinterpret_cast<UPTRINT>(Block.Data);
+		const int64 AlignedOffset = static_cast<int64>(Align(BlockStart + CurrentOffset, Alignment) - BlockStart);
+		if (AlignedOffset + static_cast<int64>(Size) <= Block.Size)
+		{
+			CurrentOffset = AlignedOffset + Size;
+			return Block.Data + AlignedOffset;
+		}
+		++CurrentBlockIndex;
+		CurrentOffset = 0;
+	}
+
+	// 남은 블록이 없으면 전역 힙에서 새 블록 할당
+	FBlock NewBlock;
+	NewBlock.Size = FMath::Max<int64>(BlockSize, static_cast<int64>(Size));
+	NewBlock.Data = static_cast<uint8*>(FMemory::Malloc(NewBlock.Size, FMath::Max<uint32>(Alignment, 64)));
+	++BlockAllocationCount;
+
+	CurrentBlockIndex = Blocks.Add(NewBlock);
+	CurrentOffset = Size;
+	return NewBlock.Data;
+}
+
+void FWFC3DArena::Reserve(const int64 Bytes)
+{
+	for (int32 BlockIndex = CurrentBlockIndex; BlockIndex < Blocks.Num(); ++BlockIndex)
+	{
+		const int64 UsedBytes = BlockIndex == CurrentBlockIndex ? CurrentOffset : 0;
+		if (Blocks[BlockIndex].Size - UsedBytes >= Bytes)
+		{
+			return;
+		}
+	}
+
+	// 남은 블록 뒤에 추가하므로 앞의 블록을 다 쓴 뒤 사용
+	FBlock NewBlock;
+	NewBlock.Size = FMath::Max(BlockSize, Bytes);
+	NewBlock.Data = static_cast<uint8*>(FMemory::Malloc(NewBlock.Size, 64));
+	++BlockAllocationCount;
+	Blocks.Add(NewBlock);
+}
+
+int64 FWFC3DArena::GetReservedBytes() const
+{
+	int64 ReservedBytes = 0;
+	for (const FBlock& Block : Blocks)
+	{
+		ReservedBytes += Block.Size;
+	}
+	return ReservedBytes;
+}
+
+FWFC3DArena* FWFC3DArena::GetCurrent()
+{
+	return CurrentWFC3DArena;
+}
+
+void FWFC3DArena::SetCurrent(FWFC3DArena* Arena)
+{
+	CurrentWFC3DArena = Arena;
+}
@@ -3,23 +3,7 @@
 
 #include "WFC/Utility/WFC3DHelperFunctions.h"
 
-TArray<int32> FWFC3DHelperFunctions::GetAllIndexFromBitset(const TBitArray<>& Bitset)
-{
-	TArray<int32> Result;
-	int32 Index = 0;
-	do
-	{
-		Index = Bitset.FindFrom(true, Index);
-		if (Index != INDEX_NONE)
-		{
-			Result.Add(Index++);
-		}
-	}
-	while (Index != INDEX_NONE);
-	return Result;
-}
-
-int32 FWFC3DHelperFunctions::GetWeightedRandomIndex(const TArray<float>& Weights, const FRandomStream* RandomStream)
+int32 FWFC3DHelperFunctions::GetWeightedRandomIndex(TConstArrayView<float> Weights, const FRandomStream* RandomStream)
 {
 	float TotalWeight = 0.0f;
 	for (const float Weight : Weights)
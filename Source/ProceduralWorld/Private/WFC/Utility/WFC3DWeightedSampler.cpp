@@ -0,0 +1,168 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "WFC/Utility/WFC3DWeightedSampler.h"
+
+#if WFC3D_DOMAIN_SIMD
+namespace
+{
+	/** 이 수 이상의 비트가 1인 워드는 벡터 레지스터로 가중치를 더함 (적으면 1인 비트만 순회하는 편이 빠름) */
+	constexpr int32 DenseWordBitsNum = 16;
+
+	/** 4비트 값 별 레인 마스크 (비트가 1인 레인만 모든 비트가 1) */
+	alignas(16) constexpr uint32 NibbleLaneMasks[16][4] = {
+		{0u, 0u, 0u, 0u}, {~0u, 0u, 0u, 0u}, {0u, ~0u, 0u, 0u}, {~0u, ~0u, 0u, 0u},
+		{0u, 0u, ~0u, 0u}, {~0u, 0u, ~0u, 0u}, {0u, ~0u, ~0u, 0u}, {~0u, ~0u, ~0u, 0u},
+		{0u, 0u, 0u, ~0u}, {~0u, 0u, 0u, ~0u}, {0u, ~0u, 0u, ~0u}, {~0u, ~0u, 0u, ~0u},
+		{0u, 0u, ~0u, ~0u}, {~0u, 0u, ~0u, ~0u}, {0u, ~0u, ~0u, ~0u}, {~0u, ~0u, ~0u, ~0u},
+	};
+}
+#endif
+
+int32 FWFC3DWeightedSampler::SampleDomain(const uint64* TileOptions, const int32 TileWordsNum, const float* TileWeights, const FRandomStream& RandomStream)
+{
+	constexpr int32 BitsPerWord = FWFC3DDomainUtils::BitsPerWord;
+
+	// 워드 별 가중치 합 (고정 크기 도메인 범위에서는 스택 버퍼)
+	TArray<float, TInlineAllocator<FWFC3DDomainUtils::MaxFixedWords>> WordWeights;
+	WordWeights.SetNumUninitialized(TileWordsNum);
+
+	float TotalWeight = 0.0f;
+	int32 FirstTileIndex = INDEX_NONE;
+	int32 LastWeightedWordIndex = INDEX_NONE;
+	for (int32 WordIndex = 0; WordIndex < TileWordsNum; ++WordIndex)
+	{
+		const uint64 Word = TileOptions[WordIndex];
+		if (Word == 0)
+		{
+			WordWeights[WordIndex] = 0.0f;
+			continue;
+		}
+		if (FirstTileIndex == INDEX_NONE)
+		{
+			FirstTileIndex = WordIndex * BitsPerWord + static_cast<int32>(FMath::CountTrailingZeros64(Word));
+		}
+
+		const float WordWeight = GetWordWeight(Word, TileWeights + WordIndex * BitsPerWord);
+		WordWeights[WordIndex] = WordWeight;
+		TotalWeight += WordWeight;
+		if (WordWeight > 0.0f)
+		{
+			LastWeightedWordIndex = WordIndex;
+		}
+	}
+
+	// 빈 도메인이거나 가중치 합이 0이면 첫 번째 타일
+	if (LastWeightedWordIndex == INDEX_NONE)
+	{
+		return FirstTileIndex;
+	}
+
+	float RandomWeight = RandomStream.FRandRange(0.0f, TotalWeight);
+	int32 WordIndex = 0;
+	while (WordIndex < LastWeightedWordIndex && RandomWeight >= WordWeights[WordIndex])
+	{
+		RandomWeight -= WordWeights[WordIndex];
+		++WordIndex;
+	}
+
+	// 선택된 워드 안에서만 순회 (부동소수점 오차로 끝까지 가면 워드의 마지막 가중치 있는 타일)
+	const float* WordTileWeights = TileWeights + WordIndex * BitsPerWord;
+	int32 SelectedTileIndex = INDEX_NONE;
+	for (uint64 RemainingWord = TileOptions[WordIndex]; RemainingWord != 0; RemainingWord &= RemainingWord - 1)
+	{
+		const int32 BitIndex = static_cast<int32>(FMath::CountTrailingZeros64(RemainingWord));
+		const float TileWeight = WordTileWeights[BitIndex];
+		if (TileWeight <= 0.0f)
+		{
+			continue;
+		}
+		SelectedTileIndex = WordIndex * BitsPerWord + BitIndex;
+		if (RandomWeight < TileWeight)
+		{
+			break;
+		}
+		RandomWeight -= TileWeight;
+	}
+	return SelectedTileIndex;
+}
+
+bool FWFC3DWeightedSampler::BuildAliasTable(TConstArrayView<double> Weights, TArray<float>& OutProbabilities, TArray<int32>& OutAliases)
+{
+	OutProbabilities.Reset();
+	OutAliases.Reset();
+
+	double TotalWeight = 0.0;
+	for (const double Weight : Weights)
+	{
+		TotalWeight += Weight;
+	}
+	if (Weights.IsEmpty() || TotalWeight <= 0.0)
+	{
+		return false;
+	}
+
+	// 평균이 1이 되도록 조정한 가중치를 1보다 작은 / 큰 항목으로 나눔
+	const int32 TilesNum = Weights.Num();
+	TArray<double> ScaledWeights;
+	ScaledWeights.SetNumUninitialized(TilesNum);
+	TArray<int32> SmallIndices;
+	TArray<int32> LargeIndices;
+	for (int32 TileIndex = 0; TileIndex < TilesNum; ++TileIndex)
+	{
+		ScaledWeights[TileIndex] = Weights[TileIndex] * TilesNum / TotalWeight;
+		(ScaledWeights[TileIndex] < 1.0 ? SmallIndices : LargeIndices).Add(TileIndex);
+	}
+
+	OutProbabilities.SetNumUninitialized(TilesNum);
+	OutAliases.SetNumUninitialized(TilesNum);
+	while (!SmallIndices.IsEmpty() && !LargeIndices.IsEmpty())
+	{
+		const int32 SmallIndex = SmallIndices.Pop();
+		const int32 LargeIndex = LargeIndices.Pop();
+		OutProbabilities[SmallIndex] = static_cast<float>(ScaledWeights[SmallIndex]);
+		OutAliases[SmallIndex] = LargeIndex;
+
+		// 큰 항목이 작은 항목의 남은 칸을 채움
+		ScaledWeights[LargeIndex] += ScaledWeights[SmallIndex] - 1.0;
+		(ScaledWeights[LargeIndex] < 1.0 ? SmallIndices : LargeIndices).Add(LargeIndex);
+	}
+
+	// 남은 항목은 부동소수점 오차만큼만 1과 다르므로 항상 자신을 선택
+	for (const TArray<int32>* RemainingIndices : {&SmallIndices, &LargeIndices})
+	{
+		for (const int32 TileIndex : *RemainingIndices)
+		{
+			OutProbabilities[TileIndex] = 1.0f;
+			OutAliases[TileIndex] = TileIndex;
+		}
+	}
+	return true;
+}
+
+float FWFC3DWeightedSampler::GetWordWeight(const uint64 Word, const float* WordWeights)
+{
+#if WFC3D_DOMAIN_SIMD
+	// 1인 비트가 많으면 타일 4개씩 레인 마스크로 가중치를 골라 더함
+	if (FMath::CountBits(Word) >= DenseWordBitsNum)
+	{
+		VectorRegister4Float WeightSums = VectorZero();
+		for (int32 NibbleIndex = 0; NibbleIndex < FWFC3DDomainUtils::BitsPerWord / 4; ++NibbleIndex)
+		{
+			const uint32 Nibble = static_cast<uint32>(Word >> (NibbleIndex * 4)) & 0xF;
+			const VectorRegister4Float LaneMask = VectorLoadAligned(reinterpret_cast<const float*>(NibbleLaneMasks[Nibble]));
+			WeightSums = VectorAdd(WeightSums, VectorBitwiseAnd(VectorLoad(WordWeights + NibbleIndex * 4), LaneMask));
+		}
+		alignas(16) float LaneSums[4];
+		VectorStoreAligned(WeightSums, LaneSums);
+		return LaneSums[0] + LaneSums[1] + LaneSums[2] + LaneSums[3];
+	}
+#endif
+
+	float WordWeight = 0.0f;
+	for (uint64 RemainingWord = Word; RemainingWord != 0; RemainingWord &= RemainingWord - 1)
+	{
+		WordWeight += WordWeights[FMath::CountTrailingZeros64(RemainingWord)];
+	}
+	return WordWeight;
+}
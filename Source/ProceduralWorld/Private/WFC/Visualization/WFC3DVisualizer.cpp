@@ -144,12 +144,12 @@ FWFC3DVisualizeResult UWFC3DVisualizer::ExecuteInternal(const FWFC3DVisualizeCon
 			FWFC3DCell& Cell = (*AllCells)[i];
 
 			// 붕괴된 셀만 시각화 데이터 준비
-			if (Cell.bIsCollapsed && Cell.CollapsedTileInfo)
+			if (Cell.IsCollapsed())
 			{
 				if (!SetTileVisualInfo(Cell, ModelData, Context.RandomStream))
 				{
 					// 데이터 준비 실패 시 경고 로그만 출력하고 계속 진행
-					UE_LOG(LogTemp, Warning, TEXT("Failed to prepare visualization data for cell at location: %s"), *Cell.Location.ToString());
+					UE_LOG(LogTemp, Warning, TEXT("Failed to prepare visualization data for cell at location: %s"), *Grid->GetCellLocation(i).ToString());
 				}
 			}
 
@@ -287,13 +287,17 @@ void UWFC3DVisualizer::CheckAsyncTaskCompletion(const FWFC3DVisualizeContext& Co
 
 bool UWFC3DVisualizer::SetTileVisualInfo(FWFC3DCell& Cell, const UWFC3DModelDataAsset* ModelData, const FRandomStream* RandomStream)
 {
-	if (!Cell.bIsCollapsed || !Cell.CollapsedTileInfo || !ModelData)
+	if (!Cell.IsCollapsed() || !ModelData)
 	{
 		return false;
 	}
 
 	// 타일 정보 가져오기
-	const FTileInfo* TileInfo = Cell.CollapsedTileInfo;
+	const FTileInfo* TileInfo = ModelData->GetTileInfo(Cell.CollapsedTileInfoIndex);
+	if (!TileInfo)
+	{
+		return false;
+	}
 	int32 BaseTileID = TileInfo->BaseTileID;
 	
 	// 타일 변형 정보 가져오기
@@ -320,7 +324,8 @@ bool UWFC3DVisualizer::SetTileVisualInfo(FWFC3DCell& Cell, const UWFC3DModelData
 	// 설정된 인덱스가 범위를 벗어나면 첫 번째 변형으로 fallback
 	if (!VisualInfo && DefaultVariantIndex != 0)
 	{
-		VisualInfo = ModelData->GetTileVisualInfo(BaseTileID, DefaultBiomeName, 0);
+		VariantIndex = 0;
+		VisualInfo = ModelData->GetTileVisualInfo(BaseTileID, DefaultBiomeName, VariantIndex);
 		UE_LOG(LogTemp, Warning, TEXT("DefaultVariantIndex %d out of range for BaseTileID %d, falling back to index 0"), DefaultVariantIndex, BaseTileID);
 	}
 
@@ -329,15 +334,15 @@ bool UWFC3DVisualizer::SetTileVisualInfo(FWFC3DCell& Cell, const UWFC3DModelData
 		return false;
 	}
 
-	// Cell의 CollapsedTileVisualInfo에 데이터 저장
-	Cell.CollapsedTileVisualInfo = const_cast<FTileVisualInfo*>(VisualInfo);
+	// Cell에는 변형 인덱스만 저장하고, 메시 생성 시 ModelData에서 다시 조회
+	Cell.CollapsedTileVariantIndex = VariantIndex;
 
 	return true;
 }
 
 void UWFC3DVisualizer::CreateMeshesFromData(UWorld* World, UWFC3DGrid* Grid, const UWFC3DModelDataAsset* ModelData)
 {
-	if (!World || !Grid)
+	if (!World || !Grid || !ModelData)
 	{
 		return;
 	}
@@ -357,10 +362,19 @@ void UWFC3DVisualizer::CreateMeshesFromData(UWorld* World, UWFC3DGrid* Grid, con
 	// Grid의 모든 셀을 순회하며 메시 생성
 	if (TArray<FWFC3DCell>* AllCells = Grid->GetAllCells())
 	{
-		for (const FWFC3DCell& Cell : *AllCells)
+		for (int32 CellIndex = 0; CellIndex < AllCells->Num(); ++CellIndex)
 		{
+			const FWFC3DCell& Cell = (*AllCells)[CellIndex];
+
 			// 붕괴된 셀이고 시각 정보가 있는 경우만 처리
-			if (!Cell.bIsCollapsed || !Cell.CollapsedTileVisualInfo || !Cell.CollapsedTileVisualInfo->StaticMesh)
+			if (!Cell.IsCollapsed() || Cell.CollapsedTileVariantIndex == INDEX_NONE)
+			{
+				continue;
+			}
+
+			const FTileInfo* TileInfo = ModelData->GetTileInfo(Cell.CollapsedTileInfoIndex);
+			const FTileVisualInfo* VisualInfo = TileInfo ? ModelData->GetTileVisualInfo(TileInfo->BaseTileID, DefaultBiomeName, Cell.CollapsedTileVariantIndex) : nullptr;
+			if (!VisualInfo || !VisualInfo->StaticMesh)
 			{
 				continue;
 			}
@@ -373,22 +387,23 @@ void UWFC3DVisualizer::CreateMeshesFromData(UWorld* World, UWFC3DGrid* Grid, con
 			}
 
 			// 메시 설정
-			MeshComponent->SetStaticMesh(Cell.CollapsedTileVisualInfo->StaticMesh);
+			MeshComponent->SetStaticMesh(VisualInfo->StaticMesh);
 
 			// 머티리얼 적용
-			for (int32 MaterialIndex = 0; MaterialIndex < Cell.CollapsedTileVisualInfo->Materials.Num(); ++MaterialIndex)
+			for (int32 MaterialIndex = 0; MaterialIndex < VisualInfo->Materials.Num(); ++MaterialIndex)
 			{
-				if (Cell.CollapsedTileVisualInfo->Materials[MaterialIndex])
+				if (VisualInfo->Materials[MaterialIndex])
 				{
-					MeshComponent->SetMaterial(MaterialIndex, Cell.CollapsedTileVisualInfo->Materials[MaterialIndex]);
+					MeshComponent->SetMaterial(MaterialIndex, VisualInfo->Materials[MaterialIndex]);
 				}
 			}
 
 			// 위치 계산
+			const FIntVector CellLocation = Grid->GetCellLocation(CellIndex);
 			FVector Location = FVector(
-				Cell.Location.X * TileSize,
-				Cell.Location.Y * TileSize,
-				Cell.Location.Z * TileSize
+				CellLocation.X * TileSize,
+				CellLocation.Y * TileSize,
+				CellLocation.Z * TileSize
 			);
 
 			// 회전 계산
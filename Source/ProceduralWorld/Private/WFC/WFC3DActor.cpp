@@ -424,7 +424,7 @@ void AWFC3DActor::CreateMeshComponentsFromGrid()
 				FIntVector GridPosition(X, Y, Z);
 				FWFC3DCell* Cell = GeneratedGrid->GetCell(GridPosition);
 				
-				if (Cell && Cell->bIsCollapsed && Cell->CollapsedTileInfo)
+				if (Cell && Cell->IsCollapsed())
 				{
 					// 셀 정보와 회전 정보를 함께 전달
 					UStaticMeshComponent* MeshComponent = CreateMeshComponentAtPosition(GridPosition, *Cell);
@@ -452,13 +452,14 @@ UStaticMeshComponent* AWFC3DActor::CreateMeshComponentAtPosition(const FIntVecto
 	}
 
 	// 셀의 타일 정보 확인
-	if (!Cell.CollapsedTileInfo)
+	const FTileInfo* CollapsedTileInfo = ExecutionContext.ModelData->GetTileInfo(Cell.CollapsedTileInfoIndex);
+	if (!CollapsedTileInfo)
 	{
 		UE_LOG(LogTemp, Error, TEXT("Cell has no collapsed tile info!"));
 		return nullptr;
 	}
 
-	const FTileInfo& TileInfo = *Cell.CollapsedTileInfo;
+	const FTileInfo& TileInfo = *CollapsedTileInfo;
 	
 	// 타일 시각 정보 가져오기
 	const FTileVariantInfo* TileVariantInfo = ExecutionContext.ModelData->GetTileVariant(TileInfo.BaseTileID);
@@ -6,6 +6,8 @@
 #include "WFC/Data/WFC3DTypes.h"
 #include "WFC/Algorithm/WFC3DCollapse.h"
 #include "WFC/Algorithm/WFC3DPropagation.h"
+#include "WFC/Algorithm/WFC3DRegionSolver.h"
+#include "WFC/Utility/WFC3DArena.h"
 #include "UObject/Object.h"
 #include "HAL/Runnable.h"
 #include "HAL/RunnableThread.h"
@@ -143,6 +145,9 @@ public:
 	/** 내부 실행 함수 (스레드 안전) */
 	FWFC3DAlgorithmResult ExecuteInternal(const FWFC3DAlgorithmContext& Context);
 
+	/** 솔버 임시 데이터용 Arena (할당 횟수 확인용) */
+	const FWFC3DArena& GetSolverArena() const { return SolverArena; }
+
 	/** 비동기 작업 상태를 확인하고 결과를 처리합니다 */
 	UFUNCTION(BlueprintCallable, Category = "WFCAlgorithm")
 	void CheckAsyncTaskCompletion();
@@ -154,6 +159,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFCAlgorithm")
 	int32 Seed = 0;
 
+	/** 영역 분할 병렬 솔버 설정 (bEnabled이면 초기 전파 이후 Collapse / Propagate 루프 대신 사용) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFCAlgorithm")
+	FWFC3DRegionSolverSettings RegionSolverSettings;
+
 	/** 알고리즘 완료 시 호출되는 델리게이트 */
 	UPROPERTY(BlueprintAssignable, Category = "WFCAlgorithm")
 	FOnWFC3DAlgorithmCompleted OnAlgorithmCompleted;
@@ -202,4 +211,11 @@ protected:
 
 	/** 비동기 작업 완료 체크용 타이머 핸들 */
 	FTimerHandle AsyncCheckTimerHandle;
+
+	/**
+	 * 솔버 임시 데이터용 Arena (Collapse / Propagation 단계마다 되돌림)
+	 * 실행 간에 블록을 유지하고 루프 전에 셀 수에 비례하는 공간을 확보하며, 첫 단계 이후의 블록 할당 횟수를 로그로 남깁니다.
+	 * Arena 블록만 세므로 Grid 자료구조, 영역 분할 솔버 메시지, Arena가 없는 작업 스레드의 할당은 포함하지 않습니다.
+	 */
+	FWFC3DArena SolverArena;
 };
@@ -30,7 +30,7 @@ class FWFC3DFunctionMaps;
 
 #define DECLARE_COLLAPSER_CELL_COLLAPSER_STRATEGY(StrategyName) \
     extern ECollapseSingleCellStrategy StrategyName##_Enum; \
-    bool StrategyName(FWFC3DCell* SelectedCell, int32 SelectedCellIndex, const FTileInfo* SelectedTileInfo)
+    bool StrategyName(UWFC3DGrid* Grid, const int32 SelectedCellIndex, const int32 SelectedTileInfoIndex, const FTileInfo* SelectedTileInfo)
 
 
 /**
@@ -79,7 +79,7 @@ class FWFC3DFunctionMaps;
     int32 StrategyName##TileInfoIndexSelector(const FWFC3DCollapseContext& Context, const int32 SelectedCellIndex)
     
 #define IMPLEMENT_COLLAPSER_CELL_COLLAPSER_STRATEGY(StrategyName) \
-    bool StrategyName##CellCollapser(FWFC3DCell* SelectedCell, int32 SelectedTileInfoIndex, const FTileInfo* SelectedTileInfo); \
+    bool StrategyName##CellCollapser(UWFC3DGrid* Grid, const int32 SelectedCellIndex, const int32 SelectedTileInfoIndex, const FTileInfo* SelectedTileInfo); \
     namespace \
     { \
         struct FRegister_##StrategyName##_CellCollapser \
@@ -93,7 +93,7 @@ class FWFC3DFunctionMaps;
         }; \
         static FRegister_##StrategyName##_CellCollapser Register_##StrategyName##_Instance; \
     } \
-    bool StrategyName##CellCollapser(FWFC3DCell* SelectedCell, int32 SelectedTileInfoIndex, const FTileInfo* SelectedTileInfo)
+    bool StrategyName##CellCollapser(UWFC3DGrid* Grid, const int32 SelectedCellIndex, const int32 SelectedTileInfoIndex, const FTileInfo* SelectedTileInfo)
 
         
 
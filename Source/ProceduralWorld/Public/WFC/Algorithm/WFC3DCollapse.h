@@ -80,6 +80,12 @@ namespace WFC3DCollapseFunctions
 		 */
 		DECLARE_COLLAPSER_CELL_SELECTOR_STRATEGY(ByEntropy);
 
+		/**
+		 * 가중 Shannon Entropy 기반 Cell 선택 함수
+		 * 타일 가중치를 반영하여, 남은 타일 수가 같아도 가중치가 한 타일에 몰린 셀을 먼저 선택합니다.
+		 */
+		DECLARE_COLLAPSER_CELL_SELECTOR_STRATEGY(ByShannonEntropy);
+
 		/**
 		 * 완전 랜덤 Cell 선택 함수
 		 */
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "WFC/Data/WFC3DTypes.h"
 #include "WFC3DAlgorithmMacros.h"
+#include "WFC/Utility/WFC3DArena.h"
+#include "WFC/Utility/WFC3DCellWorklist.h"
 #include "WFC3DPropagation.generated.h"
 
 struct FWFC3DCell;
@@ -25,16 +27,22 @@ struct PROCEDURALWORLD_API FPropagationStrategy
 public:
 	FPropagationStrategy()
 		: RangeLimitStrategy(ERangeLimitStrategy::Disable)
+		, PropagationMethod(EPropagationMethod::DomainIntersection)
 	{
 	}
 
-	FPropagationStrategy(ERangeLimitStrategy InStrategy)
+	FPropagationStrategy(ERangeLimitStrategy InStrategy, EPropagationMethod InMethod = EPropagationMethod::DomainIntersection)
 		: RangeLimitStrategy(InStrategy)
+		, PropagationMethod(InMethod)
 	{
 	}
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D")
 	ERangeLimitStrategy RangeLimitStrategy;
+
+	/** SupportCounting은 RangeLimitStrategy를 사용하지 않습니다. (항상 전체 Arc Consistency까지 전파) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D")
+	EPropagationMethod PropagationMethod;
 };
 
 /**
@@ -50,6 +58,39 @@ namespace WFC3DPropagateFunctions
 	 */
 	FPropagationResult ExecutePropagation(const FWFC3DPropagationContext& Context, const FPropagationStrategy& PropagationStrategy);
 
+	/**
+	 * AC-4 지지 수 전파 함수
+	 * 셀에서 타일이 제거되면 이웃 셀의 호환 타일 지지 수를 감소시키고, 0이 된 타일을 제거합니다.
+	 * 작업량은 제거된 타일 수에 비례하며, 지지 수가 유효하지 않으면 (첫 호출, 스냅샷 복원 이후) 현재 도메인으로 다시 계산합니다.
+	 * 방문 순서와 무관하게 Arc Consistency 고정점까지 전파하므로 DomainIntersection보다 더 많은 타일을 제거할 수 있습니다.
+	 * @param Context - WFC3D 전파 컨텍스트
+	 * @return FPropagationResult - 전파 결과
+	 */
+	FPropagationResult ExecuteSupportCountingPropagation(const FWFC3DPropagationContext& Context);
+
+	/**
+	 * Frontier 병렬 전파 함수
+	 * 대기 중인 셀(Frontier)의 새 도메인을 이전 Frontier까지의 결과로 ParallelFor에서 계산하고, Frontier 순서대로 기록한 뒤
+	 * 도메인이 줄어든 셀의 이웃으로 다음 Frontier를 구성합니다.
+	 * 각 셀은 하나의 작업에서만 계산되고 Grid는 기록 단계에서만 바뀌므로 원자적 연산이 필요 없으며,
+	 * 고정점은 방문 순서와 무관하므로 같은 시드에서 Fixpoint 방식과 같은 결과를 만듭니다.
+	 * @param Context - WFC3D 전파 컨텍스트
+	 * @param PropagationStrategy - 전파 전략 (RangeLimitStrategy 사용)
+	 * @return FPropagationResult - 전파 결과
+	 */
+	FPropagationResult ExecuteParallelPropagation(const FWFC3DPropagationContext& Context, const FPropagationStrategy& PropagationStrategy);
+
+	/**
+	 * 셀의 남은 타일 옵션이 Direction 방향 이웃 셀에 허용하는 타일 집합을 계산합니다.
+	 * @param TileOptions - 셀의 남은 타일 옵션 (TileWordsNum 워드)
+	 * @param Entropy - 셀의 남은 타일 옵션 수
+	 * @param Direction - 셀 -> 이웃 방향
+	 * @param OutSupportedTiles - TileWordsNum 워드의 결과
+	 * @param ModelData - WFC3D 모델 데이터
+	 */
+	void GatherSupportedTileOptions(const uint64* TileOptions, const int32 Entropy, const EFace Direction, uint64* OutSupportedTiles,
+	                                const UWFC3DModelDataAsset* ModelData);
+
 	/**
 	 * 최초 Grid 초기화 전파 함수
 	 */
@@ -57,12 +98,12 @@ namespace WFC3DPropagateFunctions
 	
 	/**
 	 * 단일 Cell 전파 함수
-	 * @param PropagatedCell - 전파할 Cell
+	 * @param PropagatedCellIndex - 전파할 Cell 인덱스
 	 * @param Grid - WFC3D 그리드
 	 * @param PropagationQueue - 전파 대기 큐
 	 * @param ModelData - WFC3D 모델 데이터
 	 */
-	bool PropagateCell(FWFC3DCell* PropagatedCell, UWFC3DGrid* Grid, TQueue<FIntVector>& PropagationQueue, const UWFC3DModelDataAsset* ModelData);
+	bool PropagateCell(const int32 PropagatedCellIndex, UWFC3DGrid* Grid, FWFC3DCellWorklist& PropagationQueue, const UWFC3DModelDataAsset* ModelData);
 
 	/**
 	 * 전파 범위 제한 함수 모음
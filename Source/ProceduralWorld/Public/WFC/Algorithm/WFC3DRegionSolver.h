@@ -0,0 +1,142 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WFC/Data/WFC3DTypes.h"
+#include <atomic>
+#include "WFC3DRegionSolver.generated.h"
+
+class UWFC3DGrid;
+class UWFC3DModelDataAsset;
+
+/**
+ * 영역 분할 병렬 솔버 설정
+ */
+USTRUCT(BlueprintType)
+struct PROCEDURALWORLD_API FWFC3DRegionSolverSettings
+{
+	GENERATED_BODY()
+
+public:
+	/** 영역 분할 병렬 솔버 사용 여부 (사용하지 않으면 단일 스레드 Collapse / Propagate 루프) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D")
+	bool bEnabled = false;
+
+	/** 축 별 영역 수 (영역 하나를 작업 스레드 하나가 담당) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D")
+	FIntVector RegionCounts = FIntVector(4, 4, 1);
+
+	/** 라운드 당 영역 별 최대 붕괴 수, 라운드가 끝날 때마다 롤백 지점을 저장 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D", meta = (ClampMin = "1"))
+	int32 CollapsesPerRound = 1024;
+
+	/** 모순이 발생했을 때 마지막 롤백 지점으로 되돌려 다시 시도하는 최대 횟수 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D", meta = (ClampMin = "0"))
+	int32 MaxRollbacks = 16;
+};
+
+/**
+ * 영역 분할 병렬 솔버
+ * Grid를 공간 영역으로 나누고, 각 영역의 작업 스레드가 자신의 Collapse / Propagate 루프를 실행합니다.
+ *
+ * - 작업 스레드는 자신의 영역 셀만 읽고 씁니다. 다른 영역 이웃의 제약은 Mailbox(MPSC 큐)로 받은 타일 마스크로만 반영합니다.
+ * - 영역 경계에서 도메인이 줄어들면 이웃 영역이 허용하는 타일 마스크를 이웃 영역의 Mailbox로 보냅니다.
+ * - 1단계에서는 다른 영역과 맞닿은 경계 셀을 붕괴시키지 않아 영역 사이의 직접 충돌을 피하고,
+ *   2단계에서 영역을 반 영역 크기만큼 밀어 남은 경계 셀 대부분을 다시 병렬로 붕괴시킨 뒤,
+ *   3단계에서 두 분할 모두에서 경계인 셀만 단일 영역으로 붕괴시킵니다.
+ * - 라운드가 끝나면 모든 Mailbox를 비울 때까지 전달하고, 모순이 있으면 이번 라운드에 쓴 셀만 라운드 시작 상태로 되돌립니다.
+ */
+class PROCEDURALWORLD_API FWFC3DRegionSolver
+{
+public:
+	FWFC3DRegionSolver(UWFC3DGrid* InGrid, const UWFC3DModelDataAsset* InModelData, const FWFC3DRegionSolverSettings& InSettings, const int32 InSeed);
+	~FWFC3DRegionSolver();
+
+	/**
+	 * 모든 셀을 붕괴시킵니다. Grid는 초기 전파가 끝난 상태여야 합니다.
+	 * @return 모든 셀이 붕괴되면 true, 롤백 횟수를 넘으면 false
+	 */
+	bool Solve();
+
+	/** 실행된 롤백 횟수 */
+	FORCEINLINE int32 GetRollbacksNum() const { return RollbacksNum; }
+
+	/** 실행된 라운드 수 */
+	FORCEINLINE int32 GetRoundsNum() const { return RoundsNum; }
+
+private:
+	struct FRegion;
+
+	/**
+	 * 영역을 나누고 영역 별 셀 목록, 경계 셀, Entropy 힙을 구성합니다.
+	 * @param RegionCounts - 축 별 영역 수
+	 * @param bShifted - 영역 경계를 축 별로 반 영역 크기만큼 밀지 여부
+	 */
+	void BuildRegions(const FIntVector& RegionCounts, const bool bShifted);
+
+	/**
+	 * 라운드를 반복하여 붕괴할 셀이 없을 때까지 진행합니다.
+	 * @param bInteriorOnly - 다른 영역과 맞닿은 경계 셀을 붕괴 대상에서 제외할지 여부
+	 */
+	bool RunPhase(const bool bInteriorOnly);
+
+	/** 영역의 작업 스레드 루프 (최대 CollapsesPerRound 번 붕괴) */
+	void RunRegion(FRegion& Region);
+
+	/** 모든 Mailbox가 빌 때까지 메시지를 전달합니다. */
+	void SettleMailboxes();
+
+	/** 영역의 Mailbox 메시지를 적용하고 영역 안에서 전파합니다. */
+	bool DrainMailbox(FRegion& Region);
+
+	/** 영역 안의 대기 셀을 이웃 제약으로 다시 계산합니다. */
+	bool ProcessWorklist(FRegion& Region);
+
+	/** 도메인이 줄었거나 붕괴된 셀의 이웃에 알립니다. (같은 영역은 대기 목록, 다른 영역은 Mailbox) */
+	void NotifyNeighbours(FRegion& Region, const int32 CellIndex);
+
+	/** 영역에서 Entropy가 가장 낮은 붕괴 대상 셀, 없으면 INDEX_NONE */
+	int32 PopLowestEntropyCell(FRegion& Region);
+
+	/** 셀 Entropy를 영역의 힙에 기록합니다. (이전 기록은 꺼낼 때 무시) */
+	void PushEntropy(FRegion& Region, const int32 CellIndex);
+
+	/** 이번 라운드에 셀에 처음 쓰기 전의 상태와 도메인을 영역의 실행 취소 기록에 남깁니다. */
+	void RecordUndo(FRegion& Region, const int32 CellIndex);
+
+	/** 모든 영역의 실행 취소 기록으로 이번 라운드에 쓴 셀을 되돌립니다. (단일 스레드에서 호출) */
+	void UndoRound();
+
+	/** 영역의 실행 취소 기록을 비웁니다. (라운드가 성공적으로 끝났을 때) */
+	void ClearUndo(FRegion& Region);
+
+	/** 단계 시작과 롤백 이후 영역의 대기 목록, Mailbox, 힙을 현재 Grid 상태로 다시 구성합니다. */
+	void ResetRegionsAfterRollback();
+
+	UWFC3DGrid* Grid = nullptr;
+
+	const UWFC3DModelDataAsset* ModelData = nullptr;
+
+	FWFC3DRegionSolverSettings Settings;
+
+	int32 Seed = 0;
+
+	TArray<TUniquePtr<FRegion>> Regions;
+
+	/** 셀 별 영역 인덱스 (Void / Halo 셀은 INDEX_NONE) */
+	TArray<int32> CellRegions;
+
+	/** 셀 별 영역 안의 인덱스 */
+	TArray<int32> CellLocalIndices;
+
+	/** 현재 단계가 경계 셀을 제외하는지 여부 */
+	bool bCurrentInteriorOnly = false;
+
+	/** 어느 영역에서든 모순이 발생했는지 여부 */
+	std::atomic<bool> bContradiction = false;
+
+	int32 RollbacksNum = 0;
+
+	int32 RoundsNum = 0;
+};
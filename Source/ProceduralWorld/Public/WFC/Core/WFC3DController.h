@@ -44,6 +44,10 @@ struct FWFC3DExecutionContext
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D")
 	UWFC3DModelDataAsset* ModelData;
 
+	/** 그리드 생성 설정 (셀 레이아웃, Halo 레이어, 면 별 경계 조건) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D")
+	FWFC3DGridSettings GridSettings;
+
 	/** 랜덤 시드 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D")
 	int32 RandomSeed = 0;
@@ -112,7 +116,11 @@ public:
 	UFUNCTION(BlueprintPure, Category = "WFC3D")
 	FString GetCurrentPhaseName() const { return CurrentPhaseName; }
 
-	/** 생성된 그리드를 반환합니다 */
+	/**
+	 * 생성된 그리드를 반환합니다
+	 * 한 번 반환된(성공한 실행의) Grid는 GridPool에 넣지 않으므로 다음 실행이 Reset하거나 덮어쓰지 않습니다.
+	 * 다음 실행이 성공하면 새 Grid로 교체되고(이전 Grid는 참조가 없어지면 GC가 회수), 실패하거나 취소되면 이전 결과가 그대로 유지됩니다.
+	 */
 	UFUNCTION(BlueprintPure, Category = "WFC3D")
 	UWFC3DGrid* GetGeneratedGrid() const { return GeneratedGrid; }
 
@@ -155,6 +163,24 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "WFC3D")
 	UWFC3DGrid* GeneratedGrid;
 
+	/**
+	 * 재사용 대기 중인 Grid, Dimension / ModelData / GridSettings가 같은 실행에서 재사용
+	 * 외부에 공개된 적 없는 Grid(실패 / 취소된 실행의 Grid)만 보관하므로, 성공한 실행은 항상 새 Grid를 만들고
+	 * Pool은 실패 / 취소된 실행 다음 실행의 Grid 생성과 초기화만 줄입니다. (한 실행 안의 재시도는 같은 Grid를 Reset)
+	 */
+	UPROPERTY()
+	TArray<UWFC3DGrid*> GridPool;
+
+	/** 실행 중인 Grid (백그라운드 스레드에서 푸는 동안 GC가 회수하지 않도록 참조) */
+	UPROPERTY()
+	TArray<UWFC3DGrid*> InUseGrids;
+
+	/** GridPool / InUseGrids / GeneratedGrid 변경용 크리티컬 섹션 */
+	FCriticalSection GridPoolCriticalSection;
+
+	/** GridPool에 보관하는 최대 Grid 수 */
+	static constexpr int32 MaxGridPoolSize = 4;
+
 	/** WFC3D 알고리즘 인스턴스 */
 	UPROPERTY()
 	UWFC3DAlgorithm* Algorithm;
@@ -186,6 +212,21 @@ private:
 	/** 시각화 실행 단계 */
 	FWFC3DVisualizeResult ExecuteVisualization(const FWFC3DExecutionContext& Context);
 
+	/**
+	 * Context에 맞는 Grid를 GridPool에서 꺼내거나 새로 생성하여 초기화 상태로 반환합니다.
+	 * @return 초기화된 Grid, 생성에 실패하면 nullptr
+	 */
+	UWFC3DGrid* AcquireGrid(const FWFC3DExecutionContext& Context);
+
+	/**
+	 * 사용이 끝난 Grid를 GridPool에 반환합니다. Pool이 가득 차면 가장 오래된 Grid를 버립니다.
+	 * GeneratedGrid로 공개된 Grid는 반환하지 않습니다.
+	 */
+	void ReleaseGrid(UWFC3DGrid* Grid);
+
+	/** 성공한 실행의 Grid를 GeneratedGrid로 공개합니다. */
+	void PublishGrid(UWFC3DGrid* Grid);
+
 	/** 비동기 작업 완료 체크 */
 	void CheckAsyncCompletion(const FWFC3DExecutionContext& Context);
 
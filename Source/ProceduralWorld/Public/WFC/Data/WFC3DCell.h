@@ -6,8 +6,60 @@
 #include "WFC/Data/WFC3DTypes.h"
 #include "WFC3DCell.generated.h"
 
+class UWFC3DModelDataAsset;
+
+/**
+ * WFC 알고리즘 셀 상태 플래그
+ * FWFC3DCellState::Flags에 저장됩니다.
+ */
+enum class EWFC3DCellFlags : uint8
+{
+	None = 0,
+	Collapsed = 1 << 0,
+	/** 항상 전파된 상태로 취급 (붕괴된 셀), 붕괴되지 않은 셀의 전파 여부는 Grid의 전파 Epoch로 기록 */
+	Propagated = 1 << 1,
+	/** Morton 레이아웃에서 Grid 범위 밖의 빈 셀 (항상 Collapsed로 취급) */
+	Void = 1 << 2,
+	/** Halo 레이어의 경계 셀 (Outer Cell 타일로 미리 붕괴됨) */
+	Halo = 1 << 3,
+};
+ENUM_CLASS_FLAGS(EWFC3DCellFlags);
+
+/**
+ * 셀 당 알고리즘 메타데이터 (8바이트)
+ * Entropy 탐색과 플래그 초기화가 하나의 연속된 배열만 순회하도록 한 레코드에 모아 저장합니다.
+ * 셀 위치는 저장하지 않고 셀 인덱스에서 계산합니다. (UWFC3DGrid::GetCellLocation)
+ */
+struct FWFC3DCellState
+{
+	/** 남은 타일 옵션 수 */
+	int32 Entropy = 0;
+
+	/** 붕괴된 셀(Halo 셀 포함)의 타일 인덱스, 붕괴되지 않았으면 MAX_uint16 */
+	uint16 TileIndex = MAX_uint16;
+
+	EWFC3DCellFlags Flags = EWFC3DCellFlags::None;
+
+	/** 이웃에서 전파를 받은 면 (EFace 인덱스 비트) */
+	uint8 PropagatedFaces = 0;
+};
+static_assert(sizeof(FWFC3DCellState) == 8, "FWFC3DCellState must stay 8 bytes");
+
+/**
+ * 셀에 남은 타일의 가중치 합 (Shannon Entropy 계산용)
+ * H = log(SumWeights) - SumWeightLogWeights / SumWeights
+ */
+struct FWFC3DCellWeightSums
+{
+	double SumWeights = 0.0;
+
+	double SumWeightLogWeights = 0.0;
+};
+
 /**
- * WFC 알고리즘의 셀 구조체
+ * WFC 알고리즘의 셀 결과 구조체
+ * 알고리즘 데이터(Tile Domain, FWFC3DCellState)는 UWFC3DGrid에 저장되고,
+ * 이 구조체는 붕괴 결과와 시각화 데이터의 인덱스만 가집니다. 실제 데이터는 ModelData에서 조회합니다.
  */
 USTRUCT(BlueprintType)
 struct PROCEDURALWORLD_API FWFC3DCell
@@ -17,69 +69,18 @@ struct PROCEDURALWORLD_API FWFC3DCell
 public:
 	FWFC3DCell() = default;
 
-	void Initialize(const int32 TileInfoNum, const int32 FaceInfoNum, const int32 Index, const FIntVector& Dimension);
-
-	bool FORCEINLINE IsFacePropagated(const EFace& Direction) const;
-	void FORCEINLINE SetPropagatedFaces(const EFace& Direction);
-	static FORCEINLINE FIntVector IndexToLocation(const int32 Index, const FIntVector& Dimension);
-
-	void PrintCellInfo() const
-	{
-		UE_LOG(LogTemp, Log, TEXT("Cell Location: %s, IsCollapsed: %s, IsPropagated: %s, Entropy: %d, RemainingTileOptions: %s"),
-			*Location.ToString(),
-			bIsCollapsed ? TEXT("True") : TEXT("False"),
-			bIsPropagated ? TEXT("True") : TEXT("False"),
-			Entropy,
-			*FBitString::ToString(RemainingTileOptionsBitset)
-			);
-	}
-
-	void PrintTileInfo() const
-	{
-		UE_LOG(LogTemp, Display, TEXT("Tile Info for Cell at Location: %s"), *Location.ToString());
-		if (CollapsedTileInfo)
-		{
-			UE_LOG(LogTemp, Display, TEXT("Collapsed BaseTileID : %d"), CollapsedTileInfo->BaseTileID);
-			for (int32 i = 0; i < CollapsedTileInfo->Faces.Num(); ++i)
-			{
-				UE_LOG(LogTemp, Display, TEXT("Face %d: %d"), i, CollapsedTileInfo->Faces[i]);
-			}
-		}
-		else
-		{
-			UE_LOG(LogTemp, Display, TEXT("No Tile Collapsed"));
-		}
-	}
-	
-public:
-	/** Common Data */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "WFC3D")
-	FIntVector Location;
-	
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "WFC3D")
-	bool bIsCollapsed = false;
+	void Initialize();
 
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "WFC3D")
-	bool bIsPropagated = false;
+	FORCEINLINE bool IsCollapsed() const { return CollapsedTileInfoIndex != INDEX_NONE; }
 
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "WFC3D")
-	int32 CollapsedTileInfoIndex;
-	
-	const FTileInfo* CollapsedTileInfo = nullptr;
+	void PrintTileInfo(const UWFC3DModelDataAsset* ModelData) const;
 
-	/** Algorithm Data */
+public:
+	/** Common Data */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "WFC3D")
-	int32 Entropy = 0;
-
-	TBitArray<> RemainingTileOptionsBitset;
+	int32 CollapsedTileInfoIndex = INDEX_NONE;
 
-	TArray<TBitArray<>> MergedFaceOptionsBitset;
-
-	/** Visualization Data */
-	FTileVisualInfo* CollapsedTileVisualInfo = nullptr;
-
-	
-private:
-	UPROPERTY(EditAnywhere, Category = "WFC3D")
-	uint8 PropagatedFaces = 0;
+	/** Visualization Data - 기본 바이옴에서 선택된 변형 인덱스 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "WFC3D")
+	int32 CollapsedTileVariantIndex = INDEX_NONE;
 };
@@ -0,0 +1,143 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WFC3DFaceUtils.h"
+
+/**
+ * 셀 도메인 공유(Hash-Consing) 테이블
+ * 같은 값의 Tile Domain(TileWordsNum 워드)을 한 번만 저장하고 id로 참조합니다.
+ * 초기 상태(모든 타일 허용)나 경계 전파 직후처럼 많은 셀이 같은 도메인을 가질 때, 셀은 id만 가지고 도메인을 공유합니다.
+ * 도메인 id와 마스크 키에 대한 교집합 결과 (DomainA, MaskB) -> DomainC를 고정 크기 직접 사상 캐시에 기록하여 같은 And 연산을 반복하지 않습니다.
+ *
+ * 등록된 도메인은 변경되지 않으며, id는 테이블을 복사해도 유지됩니다.
+ * 워드 배열은 MaxEntriesNum 만큼 미리 확보하므로 GetEntry가 반환한 포인터는 등록이 추가되어도 유효합니다.
+ * Grid와 스냅샷이 참조 카운트로 공유하며, 공유 중인 테이블에 처음 쓸 때 Clone으로 복사합니다. (Copy-on-Write)
+ */
+class PROCEDURALWORLD_API FWFC3DDomainTable
+{
+public:
+	/** 등록할 수 있는 최대 도메인 수, 넘으면 셀이 자신의 도메인을 가짐 */
+	static constexpr int32 MaxEntriesNum = 1024;
+
+	/** 유효하지 않은 마스크 키 (교집합을 기록하지 않음) */
+	static constexpr uint32 InvalidMaskKey = MAX_uint32;
+
+	/** 교집합 캐시 슬롯 수 (2의 거듭제곱), 같은 슬롯에 기록되면 이전 기록을 덮어씀 */
+	static constexpr int32 IntersectionSlotsShift = 13;
+	static constexpr int32 IntersectionSlotsNum = 1 << IntersectionSlotsShift;
+
+	/**
+	 * 테이블을 비우고 도메인 크기를 설정합니다.
+	 * @param InEntryWordsNum - 도메인 당 워드 수 (Grid의 TileWordsNum)
+	 */
+	void Initialize(const int32 InEntryWordsNum);
+
+	/** 같은 내용을 가진 복사본을 만듭니다. (등록 id 유지) */
+	TSharedPtr<FWFC3DDomainTable, ESPMode::ThreadSafe> Clone() const;
+
+	/**
+	 * 같은 값의 도메인 id를 찾습니다.
+	 * @return 등록된 id, 없으면 INDEX_NONE
+	 */
+	int32 Find(const uint64* Entry) const;
+
+	/**
+	 * 도메인을 등록합니다. 이미 같은 값이 있으면 기존 id를 반환합니다.
+	 * @return 등록된 id, 테이블이 가득 찼으면 INDEX_NONE
+	 */
+	int32 Intern(const uint64* Entry);
+
+	FORCEINLINE const uint64* GetEntry(const int32 DomainId) const
+	{
+		checkSlow(Entropies.IsValidIndex(DomainId));
+		return Words.GetData() + static_cast<int64>(DomainId) * EntryWordsNum;
+	}
+
+	/** 도메인의 남은 타일 옵션 수 */
+	FORCEINLINE int32 GetEntropy(const int32 DomainId) const { return Entropies[DomainId]; }
+
+	/**
+	 * 기록된 교집합 결과를 찾습니다.
+	 * @return DomainId와 MaskKey의 교집합 도메인 id, 기록이 없으면 INDEX_NONE
+	 */
+	FORCEINLINE int32 FindIntersection(const int32 DomainId, const uint32 MaskKey) const
+	{
+		const uint64 Key = MakeIntersectionKey(DomainId, MaskKey);
+		const FIntersectionSlot& Slot = Intersections[GetIntersectionSlotIndex(Key)];
+		return Slot.Key == Key ? Slot.ResultId : INDEX_NONE;
+	}
+
+	/** 교집합 결과를 기록합니다. (Initialize에서 확보한 슬롯만 쓰므로 할당 없음) */
+	FORCEINLINE void AddIntersection(const int32 DomainId, const uint32 MaskKey, const int32 ResultId)
+	{
+		const uint64 Key = MakeIntersectionKey(DomainId, MaskKey);
+		FIntersectionSlot& Slot = Intersections[GetIntersectionSlotIndex(Key)];
+		IntersectionsNum += Slot.Key == InvalidIntersectionKey ? 1 : 0;
+		Slot.Key = Key;
+		Slot.ResultId = ResultId;
+	}
+
+	/** 면 호환 타일 마스크 (GetCompatibleTileWords(FaceIndex))의 키 */
+	static FORCEINLINE uint32 MakeFaceMaskKey(const int32 FaceIndex)
+	{
+		return static_cast<uint32>(FaceIndex);
+	}
+
+	/** 공유 도메인을 가진 이웃이 Direction 반대편 셀에 허용하는 타일 마스크의 키 */
+	static FORCEINLINE uint32 MakeDomainMaskKey(const int32 NeighbourDomainId, const EFace Direction)
+	{
+		return 1u << 31 | static_cast<uint32>(NeighbourDomainId * 6 + FWFC3DFaceUtils::GetIndex(Direction));
+	}
+
+	FORCEINLINE int32 Num() const { return Entropies.Num(); }
+
+	FORCEINLINE int32 GetEntryWordsNum() const { return EntryWordsNum; }
+
+	/** 기록된 교집합 수 (사용 중인 캐시 슬롯 수) */
+	FORCEINLINE int32 GetIntersectionsNum() const { return IntersectionsNum; }
+
+private:
+	/** 비어 있는 캐시 슬롯의 키 (도메인 id가 MaxEntriesNum보다 작으므로 실제 키와 겹치지 않음) */
+	static constexpr uint64 InvalidIntersectionKey = MAX_uint64;
+
+	struct FIntersectionSlot
+	{
+		uint64 Key = InvalidIntersectionKey;
+		int32 ResultId = INDEX_NONE;
+	};
+
+	static FORCEINLINE uint64 MakeIntersectionKey(const int32 DomainId, const uint32 MaskKey)
+	{
+		return static_cast<uint64>(static_cast<uint32>(DomainId)) << 32 | MaskKey;
+	}
+
+	/** 키를 곱셈 해시(Fibonacci Hashing)로 슬롯에 사상 */
+	static FORCEINLINE int32 GetIntersectionSlotIndex(const uint64 Key)
+	{
+		return static_cast<int32>((Key * 0x9E3779B97F4A7C15ull) >> (64 - IntersectionSlotsShift));
+	}
+
+	uint32 HashEntry(const uint64* Entry) const;
+
+	/** 등록된 도메인 (MaxEntriesNum * EntryWordsNum 워드를 미리 확보) */
+	TArray<uint64, TAlignedHeapAllocator<64>> Words;
+
+	TArray<int32> Entropies;
+
+	/** 같은 해시를 가진 다음 도메인 id (해시 체인) */
+	TArray<int32> NextInBucket;
+
+	/** 해시 -> 체인의 첫 도메인 id */
+	TMap<uint32, int32> HashToFirstId;
+
+	/** (DomainId, MaskKey) -> 교집합 도메인 id 직접 사상 캐시 (IntersectionSlotsNum 슬롯) */
+	TArray<FIntersectionSlot> Intersections;
+
+	int32 IntersectionsNum = 0;
+
+	int32 EntryWordsNum = 0;
+};
+
+using FWFC3DDomainTablePtr = TSharedPtr<FWFC3DDomainTable, ESPMode::ThreadSafe>;
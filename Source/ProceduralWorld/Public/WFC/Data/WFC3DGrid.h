@@ -4,13 +4,57 @@
 
 #include "CoreMinimal.h"
 #include "WFC3DCell.h"
+#include "WFC3DDomainTable.h"
+#include "WFC3DFaceUtils.h"
 #include "UObject/Object.h"
+#include "WFC/Utility/WFC3DCellLayoutUtils.h"
+#include "WFC/Utility/WFC3DCellWorklist.h"
+#include "WFC/Utility/WFC3DDomainUtils.h"
+#include "WFC/Utility/WFC3DEntropyBuckets.h"
 #include "WFC3DGrid.generated.h"
 
 class UWFC3DModelDataAsset;
 
 /**
- * 
+ * CellsPerPage 셀의 도메인 워드를 담는 페이지
+ * Grid와 스냅샷이 참조 카운트로 공유하며, 공유 중인 페이지에 처음 쓸 때 해당 페이지만 복사합니다. (Copy-on-Write)
+ */
+struct FWFC3DDomainPage
+{
+	TArray<uint64, TAlignedHeapAllocator<64>> Words;
+};
+
+using FWFC3DDomainPagePtr = TSharedPtr<FWFC3DDomainPage, ESPMode::ThreadSafe>;
+
+/**
+ * Grid 알고리즘 데이터 스냅샷
+ * 도메인 페이지와 공유 도메인 테이블은 Grid와 공유하고, 셀 당 메타데이터(FWFC3DCellState, 공유 도메인 id)만 복사합니다.
+ * 같은 Dimension / 설정 / ModelData로 초기화된 Grid에만 복원할 수 있습니다.
+ */
+struct PROCEDURALWORLD_API FWFC3DGridState
+{
+	TArray<FWFC3DDomainPagePtr> DomainPages;
+	TArray<int32> PageLiveCells;
+	TArray<FWFC3DCellState> CellStates;
+	TArray<int32> SharedDomainIds;
+	FWFC3DDomainTablePtr DomainTable;
+	int32 RemainingCells = 0;
+};
+
+/**
+ * WFC3D 그리드
+ * 알고리즘 데이터는 Structure-of-Arrays 형태로 저장됩니다.
+ * - DomainPages: 셀 당 TileWordsNum 워드의 Tile Domain
+ *   이웃이 허용하는 타일은 ModelData의 Compatible[Tile][Direction] 테이블로 계산하므로 셀 당 병합 면 옵션은 저장하지 않습니다.
+ *   CellsPerPage 개의 셀 단위로 페이지를 나누어 할당하며, 페이지의 모든 셀이 붕괴되면 페이지를 해제합니다.
+ *   페이지는 스냅샷과 Copy-on-Write로 공유됩니다. 쓰기는 non-const 접근자, 읽기는 const 접근자를 사용해야 합니다.
+ * - SharedDomainIds: 공유 도메인 테이블(FWFC3DDomainTable)의 도메인을 참조하는 셀의 id
+ *   공유 도메인을 가진 셀은 페이지를 사용하지 않으며, 처음 쓸 때 도메인을 페이지로 복사합니다.
+ *   Reset 직후 모든 셀은 InitialDomainId를 공유하므로 페이지는 셀이 새 값으로 좁혀질 때 할당됩니다.
+ * - CellStates: 셀 당 8바이트 메타데이터 (Entropy, 플래그, 전파된 면, 붕괴된 타일 인덱스)
+ *   붕괴된 셀은 도메인 대신 타일 인덱스만 사용합니다.
+ * - NeighbourIndices: 셀 인덱스로 접근하는 이웃 테이블, 셀 위치는 저장하지 않고 인덱스에서 계산합니다.
+ * - WFC3DCells: 붕괴 결과 및 시각화 데이터
  */
 UCLASS(BlueprintType, Blueprintable)
 class PROCEDURALWORLD_API UWFC3DGrid : public UObject
@@ -21,44 +65,486 @@ public:
 	UWFC3DGrid()
 	{
 		// Grid 초기화
-		WFC3DCells.Init(FWFC3DCell(), Dimension.X * Dimension.Y * Dimension.Z);
+		BuildCellLayout();
 		RemainingCells = Dimension.X * Dimension.Y * Dimension.Z;
-		
-		UE_LOG(LogTemp, Log, TEXT("WFC3DGrid Default Constructor - Dimension: %s, RemainingCells: %d"), 
+
+		UE_LOG(LogTemp, Log, TEXT("WFC3DGrid Default Constructor - Dimension: %s, RemainingCells: %d"),
 			*Dimension.ToString(), RemainingCells);
 	}
 
-	/** Grid를 특정 크기로 초기화하는 함수 */
+	/**
+	 * Grid를 특정 크기로 초기화하는 함수
+	 * @return 초기화에 실패하면 false (InitializeGridWithSettings 참고)
+	 */
 	UFUNCTION(BlueprintCallable, Category = "WFC3D")
-	void InitializeGrid(const FIntVector& InDimension, const UWFC3DModelDataAsset* InModelData);
-	
+	bool InitializeGrid(const FIntVector& InDimension, const UWFC3DModelDataAsset* InModelData);
+
+	/**
+	 * Grid를 특정 크기와 설정(셀 레이아웃, 경계 조건 등)으로 초기화하는 함수
+	 * @return 타일 수가 uint16 타일 인덱스 범위를 넘거나 경계 조건이 잘못되었으면 false, 이 경우 Grid는 초기화되지 않은 상태로 남아 재사용 / 실행할 수 없습니다.
+	 */
+	bool InitializeGridWithSettings(const FIntVector& InDimension, const UWFC3DModelDataAsset* InModelData, const FWFC3DGridSettings& InSettings);
+
+	/**
+	 * Grid를 초기화 직후 상태(모든 타일 옵션 허용)로 되돌립니다.
+	 * 셀 레이아웃, 이웃 테이블, 경계 타일 옵션과 도메인 페이지를 재사용하므로 새 Grid를 만드는 것보다 저렴합니다.
+	 * InitializeGrid / InitializeGridWithSettings 이후에만 호출할 수 있습니다.
+	 */
+	void Reset();
+
+	/**
+	 * 현재 알고리즘 데이터의 스냅샷을 만듭니다.
+	 * 도메인 페이지는 복사하지 않고 공유하므로 비용은 페이지 수와 셀 당 메타데이터 복사에 비례합니다.
+	 */
+	FWFC3DGridState Snapshot() const;
+
+	/**
+	 * Snapshot으로 만든 상태를 복원합니다. 도메인 페이지는 스냅샷과 공유되며 처음 쓸 때 복사됩니다.
+	 * @return 셀 수나 워드 수가 달라 복원할 수 없으면 false
+	 */
+	bool RestoreState(const FWFC3DGridState& State);
+
+	/** Grid가 초기화된 ModelData와 설정과 같은지 여부 (Grid 재사용 판단용) */
+	bool IsCompatible(const FIntVector& InDimension, const UWFC3DModelDataAsset* InModelData, const FWFC3DGridSettings& InSettings) const;
+
+	FORCEINLINE const UWFC3DModelDataAsset* GetModelData() const { return ModelData; }
+
 	FORCEINLINE TArray<FWFC3DCell>* GetAllCells() { return &WFC3DCells; }
 
 	FWFC3DCell* GetCell(const int32 Index);
 	FWFC3DCell* GetCell(const FIntVector& Location);
 	FWFC3DCell* GetCell(const int32 X, const int32 Y, const int32 Z);
 
+	/** Location에 해당하는 셀 인덱스, 범위를 벗어나면 INDEX_NONE */
+	FORCEINLINE int32 GetCellIndex(const FIntVector& Location) const
+	{
+		return GetCellIndex(Location.X, Location.Y, Location.Z);
+	}
+
+	FORCEINLINE int32 GetCellIndex(const int32 X, const int32 Y, const int32 Z) const
+	{
+		if (!IsValidLocation(X, Y, Z))
+		{
+			return INDEX_NONE;
+		}
+		return AxisIndexTables[0][X + HaloOffset] + AxisIndexTables[1][Y + HaloOffset] + AxisIndexTables[2][Z + HaloOffset];
+	}
+
 	FORCEINLINE FIntVector GetDimension() const { return Dimension; }
+	FORCEINLINE const FWFC3DGridSettings& GetSettings() const { return Settings; }
+
+	/** 저장된 셀 수 (Void Cell, Halo Cell 포함) */
 	FORCEINLINE int32 Num() const { return WFC3DCells.Num(); }
 
 	int32 GetRemainingCells() const;
 	void DecreaseRemainingCells();
 
-	FORCEINLINE bool IsValidLocation(const int32 Index) const;
-	FORCEINLINE bool IsValidLocation(const FIntVector& Location) const;
-	FORCEINLINE bool IsValidLocation(const int32 X, const int32 Y, const int32 Z) const;
+	/**
+	 * 미리 계산된 Direction 방향 이웃 셀 인덱스
+	 * @return 이웃 셀 인덱스, Grid 밖이면 INDEX_NONE
+	 */
+	FORCEINLINE int32 GetNeighbourIndex(const int32 Index, const EFace Direction) const
+	{
+		return NeighbourIndices[static_cast<int64>(Index) * 6 + FWFC3DFaceUtils::GetIndex(Direction)];
+	}
+
+	/** 셀의 6방향 이웃 인덱스 배열 (EFace 순서) */
+	FORCEINLINE const int32* GetNeighbourIndices(const int32 Index) const
+	{
+		return NeighbourIndices.GetData() + static_cast<int64>(Index) * 6;
+	}
+
+	FORCEINLINE bool IsValidLocation(const int32 Index) const
+	{
+		return WFC3DCells.IsValidIndex(Index);
+	}
+
+	FORCEINLINE bool IsValidLocation(const FIntVector& Location) const
+	{
+		return IsValidLocation(Location.X, Location.Y, Location.Z);
+	}
+
+	FORCEINLINE bool IsValidLocation(const int32 X, const int32 Y, const int32 Z) const
+	{
+		return X >= 0 && X < Dimension.X && Y >= 0 && Y < Dimension.Y && Z >= 0 && Z < Dimension.Z;
+	}
+
+	/** Algorithm Data 접근 */
+	FORCEINLINE int32 GetTileWordsNum() const { return TileWordsNum; }
+	FORCEINLINE int32 GetTileInfosNum() const { return TileInfosNum; }
+
+	/** 도메인 페이지 당 셀 수 */
+	static constexpr int32 CellsPerPageShift = 8;
+	static constexpr int32 CellsPerPage = 1 << CellsPerPageShift;
+
+	/** 붕괴되지 않은 셀의 타일 인덱스 */
+	static constexpr uint16 InvalidTileIndex = MAX_uint16;
+
+	/** 초기 도메인(모든 타일 옵션 허용)의 공유 도메인 id */
+	static constexpr int32 InitialDomainId = 0;
+
+	/**
+	 * 셀의 남은 타일 옵션 (TileWordsNum 워드)
+	 * 붕괴되지 않은 Grid 셀에서만 유효합니다. 붕괴된 셀은 GetCollapsedTileIndex를 사용합니다.
+	 * 쓰기용 접근은 셀이 공유 도메인을 가지면 도메인을 페이지로 복사하고, 페이지가 스냅샷과 공유 중이면 페이지를 복사합니다.
+	 */
+	FORCEINLINE uint64* GetTileOptions(const int32 Index)
+	{
+		const int32 PageIndex = Index >> CellsPerPageShift;
+		if (SharedDomainIds[Index] != INDEX_NONE)
+		{
+			MakeCellDomainUnique(Index);
+		}
+		else if (!DomainPages[PageIndex].IsUnique())
+		{
+			MakePageUnique(PageIndex);
+		}
+		return PageData[PageIndex] + static_cast<int64>(Index & (CellsPerPage - 1)) * TileWordsNum;
+	}
+
+	FORCEINLINE const uint64* GetTileOptions(const int32 Index) const
+	{
+		if (SharedDomainIds[Index] != INDEX_NONE)
+		{
+			return DomainTable->GetEntry(SharedDomainIds[Index]);
+		}
+		checkSlow(PageData[Index >> CellsPerPageShift] != nullptr);
+		return PageData[Index >> CellsPerPageShift] + static_cast<int64>(Index & (CellsPerPage - 1)) * TileWordsNum;
+	}
+
+	/** 셀이 참조하는 공유 도메인 id, 자신의 도메인을 가지면 INDEX_NONE */
+	FORCEINLINE int32 GetSharedDomainId(const int32 Index) const { return SharedDomainIds[Index]; }
+
+	/**
+	 * 셀이 공유 도메인을 참조하도록 설정합니다. Entropy는 도메인에서 가져옵니다.
+	 * 셀이 페이지에 가지고 있던 도메인은 더 이상 사용하지 않습니다.
+	 */
+	FORCEINLINE void SetSharedDomain(const int32 Index, const int32 DomainId)
+	{
+		if (bWeightSumsValid)
+		{
+			RemoveTileWeights(Index, DomainTable->GetEntry(DomainId));
+		}
+		SharedDomainIds[Index] = DomainId;
+		SetEntropy(Index, DomainTable->GetEntropy(DomainId));
+	}
+
+	FORCEINLINE const FWFC3DDomainTable& GetDomainTable() const { return *DomainTable; }
+
+	/** 쓰기용 공유 도메인 테이블, 스냅샷과 공유 중이면 테이블을 복사합니다. */
+	FWFC3DDomainTable& GetMutableDomainTable();
+
+	/** Grid 밖 Direction 방향 Outer Cell 면의 인덱스 (GetBoundaryTileOptions의 면), FixedTile 경계 면이 아니면 INDEX_NONE */
+	FORCEINLINE int32 GetBoundaryFaceIndex(const EFace Direction) const
+	{
+		return BoundaryFaceIndices[FWFC3DFaceUtils::GetIndex(Direction)];
+	}
+
+	FORCEINLINE const FWFC3DCellState& GetCellState(const int32 Index) const { return CellStates[Index]; }
+
+	FORCEINLINE int32 GetEntropy(const int32 Index) const { return CellStates[Index].Entropy; }
+	FORCEINLINE void SetEntropy(const int32 Index, const int32 InEntropy)
+	{
+		CellStates[Index].Entropy = InEntropy;
+		if (bEntropyBucketsValid && EntropyBuckets.Contains(Index))
+		{
+			EntropyBuckets.Update(Index, InEntropy);
+		}
+
+		if (bWeightSumsValid && ShannonEntropyBuckets.Contains(Index))
+		{
+			ShannonEntropyBuckets.Update(Index, GetShannonEntropyKey(Index));
+		}
+	}
+
+	/**
+	 * 셀의 도메인을 NewTileOptions로 줄입니다. (NewTileOptions는 현재 도메인의 부분 집합)
+	 * Shannon Entropy를 유지 중이면 제거된 타일의 가중치만 셀의 가중치 합에서 뺍니다.
+	 */
+	FORCEINLINE void NarrowTileOptions(const int32 Index, const uint64* NewTileOptions, const int32 NewEntropy)
+	{
+		if (bWeightSumsValid)
+		{
+			RemoveTileWeights(Index, NewTileOptions);
+		}
+		FWFC3DDomainUtils::Copy(GetTileOptions(Index), NewTileOptions, TileWordsNum);
+		SetEntropy(Index, NewEntropy);
+	}
+
+	/** 셀의 도메인에서 타일 하나를 제거합니다. (타일은 도메인에 있어야 함) */
+	FORCEINLINE void RemoveTileOption(const int32 Index, const int32 TileIndex)
+	{
+		FWFC3DDomainUtils::ClearBit(GetTileOptions(Index), TileIndex);
+		if (bWeightSumsValid)
+		{
+			RemoveTileWeight(Index, TileIndex);
+		}
+		SetEntropy(Index, CellStates[Index].Entropy - 1);
+	}
+
+	/**
+	 * 셀 인덱스에서 계산한 Grid 좌표 (Halo 셀은 -1 또는 Dimension 좌표)
+	 * Void Cell의 위치는 의미가 없습니다.
+	 */
+	FORCEINLINE FIntVector GetCellLocation(const int32 Index) const
+	{
+		const FIntVector StorageLocation = Settings.CellLayout == EWFC3DCellLayout::Morton
+			                                   ? FWFC3DCellLayoutUtils::MortonIndexToLocation(Index, MortonDecodeTable)
+			                                   : FWFC3DCellLayoutUtils::RowMajorIndexToLocation(Index, StorageDimension);
+		return StorageLocation - FIntVector(HaloOffset);
+	}
+
+	FORCEINLINE bool IsCollapsed(const int32 Index) const
+	{
+		return EnumHasAnyFlags(CellStates[Index].Flags, EWFC3DCellFlags::Collapsed);
+	}
+
+	/** 붕괴된 셀(Halo 셀 포함)의 타일 인덱스, 붕괴되지 않았으면 InvalidTileIndex */
+	FORCEINLINE uint16 GetCollapsedTileIndex(const int32 Index) const { return CellStates[Index].TileIndex; }
+
+	FORCEINLINE bool IsVoid(const int32 Index) const
+	{
+		return EnumHasAnyFlags(CellStates[Index].Flags, EWFC3DCellFlags::Void);
+	}
+
+	FORCEINLINE bool IsHalo(const int32 Index) const
+	{
+		return EnumHasAnyFlags(CellStates[Index].Flags, EWFC3DCellFlags::Halo);
+	}
+
+	/** Grid 범위 안의 셀인지 여부 (Void / Halo Cell 제외) */
+	FORCEINLINE bool IsGridCell(const int32 Index) const
+	{
+		return !EnumHasAnyFlags(CellStates[Index].Flags, EWFC3DCellFlags::Void | EWFC3DCellFlags::Halo);
+	}
+
+	/**
+	 * Direction 방향 경계 면에 닿은 셀에 허용되는 타일 옵션 (TileWordsNum 워드)
+	 * 경계 면 조건(FWFC3DBoundarySettings)에서 Grid 초기화 시 한 번 계산되며, Unconstrained / Periodic 면은 모든 타일을 허용합니다.
+	 */
+	FORCEINLINE const uint64* GetBoundaryTileOptions(const EFace Direction) const
+	{
+		return BoundaryTileOptions.GetData() + FWFC3DFaceUtils::GetIndex(Direction) * TileWordsNum;
+	}
+
+	/** 경계 타일 마스크가 적용되는 Grid 외곽 셀 (이웃이 INDEX_NONE인 방향에 제약이 있는 셀) */
+	FORCEINLINE TConstArrayView<int32> GetBoundaryShellCells() const { return BoundaryShellCells; }
+
+	/** GetBoundaryShellCells 셀 별 적용할 경계 방향 비트 (1 << FaceIndex) */
+	FORCEINLINE TConstArrayView<uint8> GetBoundaryShellFaces() const { return BoundaryShellFaces; }
+
+	/** 경계 타일 마스크와 Periodic 축의 해시 (초기 상태 캐시 키) */
+	FORCEINLINE uint32 GetBoundaryHash() const { return BoundaryHash; }
+
+	/** 붕괴된 셀이거나 현재 전파 단계에서 전파된 셀인지 여부 */
+	FORCEINLINE bool IsPropagated(const int32 Index) const
+	{
+		return EnumHasAnyFlags(CellStates[Index].Flags, EWFC3DCellFlags::Propagated) || PropagatedEpochs[Index] == PropagationEpoch;
+	}
+
+	/** 현재 전파 단계에서 셀의 전파 여부를 기록합니다. */
+	FORCEINLINE void SetPropagated(const int32 Index, const bool bPropagated)
+	{
+		PropagatedEpochs[Index] = bPropagated ? PropagationEpoch : 0;
+	}
+
+	/**
+	 * 새 전파 단계를 시작합니다.
+	 * Epoch만 증가시키므로 이전 단계에서 전파된 셀은 셀을 순회하지 않고 모두 전파되지 않은 상태가 됩니다.
+	 */
+	void BeginPropagationEpoch();
+
+	FORCEINLINE bool IsFacePropagated(const int32 Index, const EFace Direction) const
+	{
+		return (CellStates[Index].PropagatedFaces & 1 << FWFC3DFaceUtils::GetIndex(Direction)) != 0;
+	}
+
+	FORCEINLINE void SetPropagatedFace(const int32 Index, const EFace Direction)
+	{
+		CellStates[Index].PropagatedFaces |= 1 << FWFC3DFaceUtils::GetIndex(Direction);
+	}
+
+	/** 전파 대기 셀 목록 (셀 수 크기, 단계 사이에 재사용) */
+	FORCEINLINE FWFC3DCellWorklist& GetPropagationWorklist() { return PropagationWorklist; }
+
+	/**
+	 * 붕괴되지 않은 Grid 셀의 Entropy 버킷
+	 * SetEntropy와 CollapseCell이 갱신하며, 무효화된 뒤 처음 접근할 때 현재 셀 상태로 다시 구성합니다.
+	 */
+	FWFC3DEntropyBuckets& GetEntropyBuckets();
+
+	/** Entropy 버킷을 다음 접근 때 다시 구성하도록 표시합니다. (Reset, RestoreState, 동시 쓰기) */
+	FORCEINLINE void InvalidateEntropyBuckets() { bEntropyBucketsValid = false; }
+
+	/**
+	 * 붕괴되지 않은 Grid 셀의 가중치 Shannon Entropy 버킷 (키는 GetShannonEntropyKey)
+	 * 처음 접근할 때 셀 별 가중치 합을 도메인에서 계산하고, 이후에는 SetSharedDomain / NarrowTileOptions / RemoveTileOption이
+	 * 제거된 타일의 가중치만 빼서 갱신합니다.
+	 */
+	FWFC3DEntropyBuckets& GetShannonEntropyBuckets();
+
+	/**
+	 * 셀 가중치 합과 Shannon Entropy 버킷을 다음 접근 때 다시 계산하도록 표시합니다.
+	 * 도메인 포인터에 직접 쓴 경우(동시 쓰기 등) 호출해야 합니다.
+	 */
+	FORCEINLINE void InvalidateWeightSums() { bWeightSumsValid = false; }
+
+	/** Shannon Entropy 버킷 키의 1 nat 당 버킷 수 (차이가 이보다 작은 Entropy는 같은 버킷에서 무작위로 선택) */
+	static constexpr int32 ShannonEntropyBucketsPerNat = 64;
+
+	/**
+	 * 셀 가중치 합으로 계산한 Shannon Entropy 버킷 키 (bWeightSumsValid일 때만 유효)
+	 * 타일 옵션이 없으면 0, 그 외에는 1 + floor(H * ShannonEntropyBucketsPerNat)입니다.
+	 */
+	int32 GetShannonEntropyKey(const int32 Index) const;
+
+	/**
+	 * AC-4 전파의 지지 수 배열 (TileInfosNum 개)
+	 * 각 값은 셀 Index의 Direction 방향 이웃에 남은 타일 중 해당 타일과 호환되는 타일 수입니다.
+	 * 이웃이 Grid 밖이거나 붕괴된 경우에는 0 또는 1입니다.
+	 */
+	FORCEINLINE uint16* GetSupportCounts(const int32 Index, const EFace Direction)
+	{
+		checkSlow(bSupportCountsValid);
+		return SupportCounts.GetData() + (static_cast<int64>(Index) * 6 + FWFC3DFaceUtils::GetIndex(Direction)) * TileInfosNum;
+	}
+
+	/** 지지 수가 현재 도메인과 일치하는지 여부 */
+	FORCEINLINE bool HasValidSupportCounts() const { return bSupportCountsValid; }
+
+	/** AC-4 지지 수 배열의 최대 크기 (1GB), 넘으면 지지 수 전파를 사용할 수 없음 */
+	static constexpr int64 MaxSupportCountsBytes = 1ll << 30;
+
+	/** 이 Grid의 지지 수 배열 크기 (셀 수 * 6 * TileInfosNum * uint16) */
+	int64 GetSupportCountsBytes() const;
+
+	/** 지지 수 배열이 MaxSupportCountsBytes 이하인지 여부 */
+	FORCEINLINE bool CanAllocateSupportCounts() const { return GetSupportCountsBytes() <= MaxSupportCountsBytes; }
+
+	/**
+	 * 지지 수 배열을 할당하고 유효하다고 표시합니다. (값은 호출자가 채움)
+	 * @return 배열이 MaxSupportCountsBytes를 넘어 할당하지 않았으면 false
+	 */
+	bool AllocateSupportCounts();
+
+	/** 도메인이 지지 수 갱신 없이 바뀌었음을 기록합니다. (Reset, RestoreState, 비트셋 전파) */
+	FORCEINLINE void InvalidateSupportCounts() { bSupportCountsValid = false; }
+
+	/**
+	 * 셀을 단일 타일로 붕괴시킵니다.
+	 * 타일 인덱스만 기록하고 결과 데이터를 설정하며, 셀의 도메인은 더 이상 사용하지 않습니다.
+	 * 페이지의 모든 셀이 붕괴되면 페이지 메모리를 해제합니다.
+	 */
+	void CollapseCell(const int32 Index, const int32 TileInfoIndex);
+
+	/**
+	 * 여러 스레드가 서로 다른 셀에 동시에 쓸 수 있도록 준비합니다. (단일 스레드에서 호출)
+	 * 붕괴되지 않은 모든 Grid 셀이 스냅샷과 공유하지 않는 페이지에 자신의 도메인을 가지도록 하여,
+	 * 이후 셀 도메인 쓰기가 다른 셀이나 공유 데이터(페이지 목록, 공유 도메인 테이블)를 바꾸지 않게 합니다.
+	 */
+	void PrepareConcurrentWrites();
+
+	/**
+	 * 셀을 단일 타일로 붕괴시키되 셀 자신의 데이터만 씁니다. (PrepareConcurrentWrites 이후 여러 스레드에서 호출 가능)
+	 * 페이지 반환과 남은 셀 수 갱신은 FinishConcurrentCollapses에서 처리합니다.
+	 */
+	void CollapseCellConcurrent(const int32 Index, const int32 TileInfoIndex);
+
+	/** CollapseCellConcurrent로 붕괴된 셀의 페이지 반환과 남은 셀 수를 갱신합니다. (단일 스레드에서 호출) */
+	void FinishConcurrentCollapses(TConstArrayView<int32> CollapsedIndices);
+
+	/**
+	 * 붕괴되지 않았던 셀을 이전 상태와 도메인으로 되돌립니다. (PrepareConcurrentWrites 이후 서로 다른 셀에 여러 스레드에서 호출 가능)
+	 * FinishConcurrentCollapses 전이면 CollapseCellConcurrent로 붕괴된 셀도 되돌릴 수 있습니다.
+	 */
+	void RestoreCellConcurrent(const int32 Index, const FWFC3DCellState& State, const uint64* TileOptions);
+
+	/**
+	 * 붕괴 결과를 Grid 좌표 순서(X + Y * DimX + Z * DimX * DimY)의 타일 인덱스 배열로 반환합니다.
+	 * 셀 레이아웃, Halo 레이어와 무관하며 붕괴되지 않은 셀은 InvalidTileIndex입니다.
+	 */
+	TArray<uint16> GetSolvedTiles() const;
+
+	/** 할당된 도메인 페이지 수 (디버그용) */
+	int32 GetAllocatedPagesNum() const;
+
+	void PrintCellInfo(const int32 Index) const
+	{
+		const bool bHasDomain = !IsCollapsed(Index) && (SharedDomainIds[Index] != INDEX_NONE ||
+			(!PageData.IsEmpty() && PageData[Index >> CellsPerPageShift] != nullptr));
+		const FWFC3DCellState& CellState = CellStates[Index];
+		UE_LOG(LogTemp, Log, TEXT("Cell Location: %s, IsCollapsed: %s, IsPropagated: %s, Entropy: %d, TileIndex: %d, RemainingTileOptions: %s"),
+			*GetCellLocation(Index).ToString(),
+			IsCollapsed(Index) ? TEXT("True") : TEXT("False"),
+			IsPropagated(Index) ? TEXT("True") : TEXT("False"),
+			CellState.Entropy,
+			CellState.TileIndex == InvalidTileIndex ? INDEX_NONE : static_cast<int32>(CellState.TileIndex),
+			bHasDomain ? *FWFC3DDomainUtils::ToString(GetTileOptions(Index), TileInfosNum) : TEXT("")
+			);
+	}
 
 	void PrintGridInfo() const
 	{
-		UE_LOG(LogTemp, Log, TEXT("WFC3DGrid Info - Dimension: %s, Total Cells: %d, Remaining Cells: %d"), 
+		UE_LOG(LogTemp, Log, TEXT("WFC3DGrid Info - Dimension: %s, Total Cells: %d, Remaining Cells: %d"),
 			*Dimension.ToString(), WFC3DCells.Num(), RemainingCells);
-		for (const FWFC3DCell& Cell : WFC3DCells)
+		for (int32 Index = 0; Index < WFC3DCells.Num(); ++Index)
 		{
-			Cell.PrintCellInfo();
+			if (IsGridCell(Index))
+			{
+				PrintCellInfo(Index);
+			}
 		}
 	}
-	
+
 private:
+	/** 셀 수에 맞게 병렬 배열을 할당합니다. */
+	void AllocateCells(const int32 NumCells);
+
+	/** Dimension과 Settings에 맞게 셀 배열을 할당하고 레이아웃(축 인덱스 테이블, 위치 디코드 테이블, 이웃 테이블)을 구성합니다. */
+	void BuildCellLayout();
+
+	/** 셀을 단일 타일로 설정합니다. (타일 인덱스, Entropy) */
+	void SetSingleTile(const int32 Index, const int32 TileInfoIndex);
+
+	/**
+	 * 페이지 별 남은 셀 수를 계산하고 모든 페이지를 반환합니다.
+	 * 모든 셀이 초기 공유 도메인을 참조하므로, 페이지는 셀이 자신의 도메인을 가질 때 다시 할당됩니다.
+	 */
+	void ResetDomainPages();
+
+	/** 셀이 붕괴되어 도메인이 필요 없어졌음을 기록하고, 페이지의 모든 셀이 붕괴되면 페이지를 반환합니다. */
+	void ReleaseCellDomain(const int32 Index);
+
+	/** 셀의 현재 도메인에서 NewTileOptions에 없는 타일의 가중치를 셀 가중치 합에서 뺍니다. */
+	void RemoveTileWeights(const int32 Index, const uint64* NewTileOptions);
+
+	/** 타일 하나의 가중치를 셀 가중치 합에서 뺍니다. */
+	void RemoveTileWeight(const int32 Index, const int32 TileIndex);
+
+	/** 가장 큰 Shannon Entropy 버킷 키 (가중 Shannon Entropy는 log(TileInfosNum)을 넘지 않음) */
+	FORCEINLINE int32 GetMaxShannonEntropyKey() const
+	{
+		return 1 + FMath::CeilToInt32(FMath::Loge(static_cast<double>(FMath::Max(TileInfosNum, 1))) * ShannonEntropyBucketsPerNat);
+	}
+
+	/** 반환된 페이지를 재사용하거나 새 페이지를 할당합니다. (내용은 초기화하지 않음) */
+	FWFC3DDomainPagePtr AcquireDomainPage();
+
+	/** 페이지를 교체하고 PageData를 갱신합니다. */
+	void SetDomainPage(const int32 PageIndex, FWFC3DDomainPagePtr Page);
+
+	/** 스냅샷과 공유 중인 페이지를 복사하여 이 Grid만 참조하도록 합니다. */
+	void MakePageUnique(const int32 PageIndex);
+
+	/** 공유 도메인을 가진 셀의 도메인을 페이지로 복사하여 셀이 자신의 도메인을 가지도록 합니다. */
+	void MakeCellDomainUnique(const int32 Index);
+
+	/** 경계 면 조건으로 경계 타일 옵션, Halo 셀 타일, 외곽 셀 목록을 초기화합니다. */
+	bool InitializeBoundary(const UWFC3DModelDataAsset* InModelData);
+
+	/** Direction 축이 Periodic 경계인지 여부 (한쪽 면만 Periodic이어도 축 전체에 적용) */
+	bool IsPeriodicAxis(const EFace Direction) const;
+
 	UPROPERTY(EditAnywhere, Category = "WFC3D")
 	TArray<FWFC3DCell> WFC3DCells;
 
@@ -67,4 +553,93 @@ private:
 
 	UPROPERTY(EditAnywhere, Category = "WFC3D")
 	int32 RemainingCells = 0;
+
+	UPROPERTY(EditAnywhere, Category = "WFC3D")
+	FWFC3DGridSettings Settings;
+
+	/** Grid가 초기화된 ModelData */
+	UPROPERTY()
+	TObjectPtr<const UWFC3DModelDataAsset> ModelData = nullptr;
+
+	/** 축 별 인덱스 테이블, 셀 인덱스 = X 테이블 + Y 테이블 + Z 테이블 (Halo 포함 저장 좌표 기준) */
+	TArray<int32> AxisIndexTables[3];
+
+	/** Morton 레이아웃의 셀 인덱스 -> 저장 좌표 디코드 테이블 (FWFC3DCellLayoutUtils::BuildMortonDecodeTable) */
+	TArray<FIntVector> MortonDecodeTable;
+
+	/** Halo 레이어 두께 (0 또는 1) */
+	int32 HaloOffset = 0;
+
+	/** Halo 레이어를 포함한 저장 공간 크기 */
+	FIntVector StorageDimension = FIntVector::ZeroValue;
+
+	/** 방향 별 경계 면에 닿은 셀의 허용 타일 옵션 (6 * TileWordsNum 워드) */
+	TArray<uint64> BoundaryTileOptions;
+
+	/** 방향 별 Grid 밖 Outer Cell 면 인덱스 */
+	int32 BoundaryFaceIndices[6] = {INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE};
+
+	/** 경계 타일 마스크가 적용되는 Grid 외곽 셀과 셀 별 경계 방향 비트 */
+	TArray<int32> BoundaryShellCells;
+	TArray<uint8> BoundaryShellFaces;
+
+	uint32 BoundaryHash = 0;
+
+	/** 셀 당 6개의 이웃 셀 인덱스 (EFace 순서, Grid 밖이면 INDEX_NONE) */
+	TArray<int32> NeighbourIndices;
+
+	/** Algorithm Data - Structure of Arrays */
+	/** CellsPerPage 셀 단위 도메인 페이지, 해제된 페이지는 nullptr */
+	TArray<FWFC3DDomainPagePtr> DomainPages;
+
+	/** 페이지 별 워드 배열 시작 주소 (읽기 접근 시 간접 참조를 줄이기 위한 캐시) */
+	TArray<uint64*> PageData;
+
+	/** 페이지 별 붕괴되지 않은 Grid 셀 수 */
+	TArray<int32> PageLiveCells;
+
+	/** 모든 셀이 붕괴되어 반환된 페이지 (이 Grid만 참조), Reset에서 재사용 */
+	TArray<FWFC3DDomainPagePtr> FreeDomainPages;
+
+	/** 셀 당 메타데이터 (Entropy, 플래그, 전파된 면, 붕괴된 타일 인덱스) */
+	TArray<FWFC3DCellState> CellStates;
+
+	/** 셀 별 마지막으로 전파된 단계의 Epoch (PropagationEpoch와 같으면 현재 단계에서 전파됨) */
+	TArray<uint32> PropagatedEpochs;
+
+	/** 현재 전파 단계의 Epoch (0은 전파되지 않은 셀의 값으로 사용하지 않음) */
+	uint32 PropagationEpoch = 1;
+
+	/** 셀 별 공유 도메인 id, 자신의 도메인(페이지)을 가지거나 붕괴된 셀은 INDEX_NONE */
+	TArray<int32> SharedDomainIds;
+
+	/** 공유 도메인 테이블, 스냅샷과 Copy-on-Write로 공유 */
+	FWFC3DDomainTablePtr DomainTable;
+
+	/** 전파 대기 셀 목록 */
+	FWFC3DCellWorklist PropagationWorklist;
+
+	/** 붕괴되지 않은 Grid 셀의 Entropy 버킷 (Cell Selector의 최소 Entropy 탐색용) */
+	FWFC3DEntropyBuckets EntropyBuckets;
+
+	bool bEntropyBucketsValid = false;
+
+	/** 셀 별 남은 타일 가중치 합, bWeightSumsValid일 때만 유지 */
+	TArray<FWFC3DCellWeightSums> CellWeightSums;
+
+	/** 붕괴되지 않은 Grid 셀의 Shannon Entropy 버킷 */
+	FWFC3DEntropyBuckets ShannonEntropyBuckets;
+
+	bool bWeightSumsValid = false;
+
+	/** AC-4 전파용 셀 / 방향 / 타일 별 지지 수 (셀 당 6 * TileInfosNum), 해당 전파 전략에서만 할당 */
+	TArray64<uint16> SupportCounts;
+
+	bool bSupportCountsValid = false;
+
+	int32 TileWordsNum = 0;
+
+	int32 TileInfosNum = 0;
+
+	int32 FaceInfosNum = 0;
 };
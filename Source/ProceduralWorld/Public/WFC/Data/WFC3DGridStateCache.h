@@ -0,0 +1,41 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWFC3DGrid;
+
+/**
+ * 초기 전파(ExecuteInitialPropagation) 이후의 Grid 상태 캐시
+ * 초기 전파 결과는 ModelData와 Dimension, Grid 설정에만 의존하므로,
+ * 처음 실행한 결과를 스냅샷으로 저장해 두고 이후의 실행, 재시도, 다른 Actor에서는 스냅샷으로 복원합니다.
+ * 키: ModelData 해시 (GetAlgorithmDataHash), Dimension, 셀 레이아웃, Halo 레이어 사용 여부
+ */
+class PROCEDURALWORLD_API FWFC3DGridStateCache
+{
+public:
+	/** 캐시에 보관하는 최대 상태 수, 넘으면 가장 오래된 상태를 버림 */
+	static constexpr int32 MaxEntriesNum = 8;
+
+	/**
+	 * 초기화 직후의 Grid를 캐시된 초기 전파 이후 상태로 복원합니다.
+	 * @return 캐시된 상태가 없거나 복원에 실패하면 false
+	 */
+	static bool RestoreInitialState(UWFC3DGrid* Grid);
+
+	/** 초기 전파를 마친 Grid의 상태를 캐시에 저장합니다. */
+	static void StoreInitialState(const UWFC3DGrid* Grid);
+
+	/** 캐시된 모든 상태를 제거합니다. */
+	static void Clear();
+
+private:
+	/** 유틸리티 클래스 생성자 및 소멸자 제거 */
+	FWFC3DGridStateCache() = delete;
+	FWFC3DGridStateCache(const FWFC3DGridStateCache&) = delete;
+	FWFC3DGridStateCache& operator=(const FWFC3DGridStateCache&) = delete;
+	FWFC3DGridStateCache(FWFC3DGridStateCache&&) = delete;
+	FWFC3DGridStateCache& operator=(FWFC3DGridStateCache&&) = delete;
+	~FWFC3DGridStateCache() = delete;
+};
@@ -46,6 +46,54 @@ public:
 	virtual const float GetTileWeight(int32 TileIndex) const override;
 	/** End Algorithm Interface */
 
+	/** 특정 면에 대해 호환되는 타일 도메인을 uint64 워드 배열로 가져오기 */
+	const uint64* GetCompatibleTileWords(int32 FaceIndex) const;
+
+	/**
+	 * TileIndex 타일이 Direction 방향 이웃 셀에 허용하는 타일 도메인 (Compatible[Tile][Direction], TileWordsNum 워드)
+	 * InitializePropagatorTable에서 한 번 계산됩니다.
+	 */
+	FORCEINLINE const uint64* GetTileCompatibleWords(const int32 TileIndex, const EFace Direction) const
+	{
+		checkSlow(TileIndex >= 0 && TileIndex < TileInfos.Num());
+		return TileCompatibleWords.GetData() + (static_cast<int64>(TileIndex) * 6 + FWFC3DFaceUtils::GetIndex(Direction)) * TileWordsNum;
+	}
+
+	/** FaceIndex 면을 해당 면 방향에 가진 타일 집합 (면 클래스, TileWordsNum 워드) */
+	FORCEINLINE const uint64* GetFaceClassTileWords(const int32 FaceIndex) const
+	{
+		checkSlow(FaceIndex >= 0 && FaceIndex < FaceInfos.Num());
+		return FaceClassTileWords.GetData() + static_cast<int64>(FaceIndex) * TileWordsNum;
+	}
+
+	/** Direction 방향 면(면 클래스)의 인덱스 목록 */
+	FORCEINLINE const TArray<int32>& GetDirectionFaceIndices(const EFace Direction) const
+	{
+		return DirectionFaceIndices[FWFC3DFaceUtils::GetIndex(Direction)];
+	}
+
+	/** 타일 별 가중치 (TileInfos 순서, 음수 가중치는 0) */
+	FORCEINLINE TConstArrayView<double> GetTileWeights() const { return TileWeights; }
+
+	/** 타일 별 w * log(w) (Shannon Entropy 계산용, 가중치가 0이면 0) */
+	FORCEINLINE TConstArrayView<double> GetTileWeightLogWeights() const { return TileWeightLogWeights; }
+
+	/** 타일 샘플링용 가중치 (TileWordsNum * 64개, 도메인 워드와 같은 배치로 패딩 타일은 0) */
+	FORCEINLINE const float* GetTileSampleWeights() const { return TileSampleWeights.GetData(); }
+
+	/** 모든 타일이 남은 도메인의 샘플링용 Alias 테이블 (가중치 합이 0이면 비어 있음) */
+	FORCEINLINE TConstArrayView<float> GetTileAliasProbabilities() const { return TileAliasProbabilities; }
+	FORCEINLINE TConstArrayView<int32> GetTileAliasIndices() const { return TileAliasIndices; }
+
+	/** 타일 도메인 하나를 표현하는 워드 수 (TWFCDomain 인스턴스에 맞게 정렬됨) */
+	FORCEINLINE int32 GetTileWordsNum() const { return TileWordsNum; }
+
+	/** 면 도메인 하나를 표현하는 워드 수 */
+	FORCEINLINE int32 GetFaceWordsNum() const { return FaceWordsNum; }
+
+	/** 전파 결과에 영향을 주는 데이터(타일 면 구성, 면 호환 테이블)의 해시 */
+	FORCEINLINE uint32 GetAlgorithmDataHash() const { return AlgorithmDataHash; }
+
 	/** Visualization Interface */
 	virtual bool InitializeVisualizationData() override;
 	virtual const TArray<FTileRotationInfo>* GetTileRotationInfos() const override;
@@ -61,6 +109,9 @@ private:
 	bool InitializeFaceInfo();
 	bool InitializeTileInfo();
 	bool InitializeFaceToTile();
+	bool InitializeFaceToTileWords();
+	bool InitializePropagatorTable();
+	bool InitializeTileWeightTable();
 	bool InitializeTileVariantInfo();
 
 	bool LoadFaceToTileBitArrays();
@@ -110,6 +161,37 @@ private:
 
 	TArray<TBitArray<>> FaceToTileBitArrays;
 
+	/** FaceToTileBitArrays를 Grid 비트 평면과 같은 워드 형식으로 펼친 배열 (Face 당 TileWordsNum 워드) */
+	TArray<uint64> FaceToTileWords;
+
+	/** 타일 / 방향 별 이웃 허용 타일 도메인 ((Tile * 6 + Direction) * TileWordsNum 워드) */
+	TArray<uint64> TileCompatibleWords;
+
+	/** 면 별 해당 면을 가진 타일 도메인 (Face * TileWordsNum 워드) */
+	TArray<uint64> FaceClassTileWords;
+
+	/** 방향 별 면 인덱스 목록 (EFace 순서) */
+	TArray<int32> DirectionFaceIndices[6];
+
+	/** 타일 별 가중치 (TileInfos 순서) */
+	TArray<double> TileWeights;
+
+	/** 타일 별 w * log(w) */
+	TArray<double> TileWeightLogWeights;
+
+	/** 타일 샘플링용 가중치 (도메인 워드 배치) */
+	TArray<float> TileSampleWeights;
+
+	/** 전체 타일 Alias 테이블 (타일 별 자신을 선택할 확률, 대신 선택할 타일) */
+	TArray<float> TileAliasProbabilities;
+	TArray<int32> TileAliasIndices;
+
+	int32 TileWordsNum = 0;
+
+	int32 FaceWordsNum = 0;
+
+	uint32 AlgorithmDataHash = 0;
+
 	/** Visualization Data */
 	UPROPERTY(EditAnywhere, Category = "WFC3D|Data")
 	TArray<FTileVariantInfo> TileVariants;
@@ -433,6 +433,139 @@ struct FRandomStream;
 class UWFC3DGrid;
 class UWFC3DModelDataAsset;
 
+/**
+ * Grid 셀 저장 순서 열거형
+ */
+UENUM(BlueprintType)
+enum class EWFC3DCellLayout : uint8
+{
+	/** X + Y * DimX + Z * DimX * DimY (Default) */
+	RowMajor UMETA(DisplayName = "Row Major"),
+
+	/** Z-order 곡선, 공간적으로 가까운 셀이 메모리에서도 가까움 */
+	Morton UMETA(DisplayName = "Morton"),
+};
+
+/**
+ * Grid 경계 면 조건 열거형
+ */
+UENUM(BlueprintType)
+enum class EWFC3DBoundaryMode : uint8
+{
+	/** Grid 밖이 지정한 타일로 채워진 것으로 간주 (Default, 0번 타일) */
+	FixedTile UMETA(DisplayName = "Fixed Tile"),
+
+	/** 경계 면에 닿은 셀에 지정한 타일만 허용 */
+	AllowedTiles UMETA(DisplayName = "Allowed Tiles"),
+
+	/** 경계 면 제약 없음 */
+	Unconstrained UMETA(DisplayName = "Unconstrained"),
+
+	/** 반대편 경계 면의 셀과 이웃 (해당 축의 양쪽 면에 적용) */
+	Periodic UMETA(DisplayName = "Periodic"),
+};
+
+/**
+ * Grid 경계 면 하나의 조건
+ */
+USTRUCT(BlueprintType)
+struct PROCEDURALWORLD_API FWFC3DBoundaryFaceSpec
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D")
+	EWFC3DBoundaryMode Mode = EWFC3DBoundaryMode::FixedTile;
+
+	/** FixedTile에서 Grid 밖을 채우는 타일 인덱스 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D", meta = (EditCondition = "Mode == EWFC3DBoundaryMode::FixedTile", ClampMin = "0"))
+	int32 TileIndex = 0;
+
+	/** AllowedTiles에서 경계 면에 닿은 셀에 허용되는 타일 인덱스 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D", meta = (EditCondition = "Mode == EWFC3DBoundaryMode::AllowedTiles"))
+	TArray<int32> AllowedTileIndices;
+
+	bool operator==(const FWFC3DBoundaryFaceSpec& Other) const
+	{
+		return Mode == Other.Mode && TileIndex == Other.TileIndex && AllowedTileIndices == Other.AllowedTileIndices;
+	}
+};
+
+/**
+ * Grid 6개 경계 면의 조건
+ * Grid 초기화 시 면 별 경계 타일 마스크로 변환되며, 초기 전파에서 Grid 외곽 셀에 한 번 적용됩니다.
+ */
+USTRUCT(BlueprintType)
+struct PROCEDURALWORLD_API FWFC3DBoundarySettings
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D")
+	FWFC3DBoundaryFaceSpec Up;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D")
+	FWFC3DBoundaryFaceSpec Back;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D")
+	FWFC3DBoundaryFaceSpec Right;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D")
+	FWFC3DBoundaryFaceSpec Left;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D")
+	FWFC3DBoundaryFaceSpec Front;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D")
+	FWFC3DBoundaryFaceSpec Down;
+
+	/** Direction 방향 경계 면의 조건 */
+	const FWFC3DBoundaryFaceSpec& GetFace(const EFace Direction) const
+	{
+		switch (Direction)
+		{
+		case EFace::Up: return Up;
+		case EFace::Back: return Back;
+		case EFace::Right: return Right;
+		case EFace::Left: return Left;
+		case EFace::Front: return Front;
+		default: return Down;
+		}
+	}
+
+	bool operator==(const FWFC3DBoundarySettings& Other) const
+	{
+		return Up == Other.Up && Back == Other.Back && Right == Other.Right && Left == Other.Left && Front == Other.Front && Down == Other.Down;
+	}
+};
+
+/**
+ * Grid 생성 설정 구조체
+ */
+USTRUCT(BlueprintType)
+struct PROCEDURALWORLD_API FWFC3DGridSettings
+{
+	GENERATED_BODY()
+
+public:
+	FWFC3DGridSettings() = default;
+
+	/** 셀 저장 순서 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D")
+	EWFC3DCellLayout CellLayout = EWFC3DCellLayout::RowMajor;
+
+	/**
+	 * Grid 바깥을 1칸 두께의 Halo 셀로 감쌀지 여부
+	 * Halo 셀은 경계 면의 FixedTile 타일로 미리 붕괴되어, 경계 처리가 일반 전파와 같아집니다.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D")
+	bool bUseHaloLayer = false;
+
+	/** 경계 면 조건, Halo 레이어는 FixedTile 면에만 사용됩니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WFC3D")
+	FWFC3DBoundarySettings Boundary;
+};
+
 /**
  * WFC3D 알고리즘 컨텍스트 - Collapse 및 Propagation 함수에 공통적으로 사용되는 매개변수
  */
@@ -575,6 +708,9 @@ struct PROCEDURALWORLD_API FWFC3DAlgorithmResult : public FResult
 public:
 	TArray<FCollapseResult> CollapseResults;
 	TArray<FPropagationResult> PropagationResults;
+
+	/** 붕괴 결과 타일 인덱스 (Grid 좌표 순서: X + Y * DimX + Z * DimX * DimY) */
+	TArray<uint16> SolvedTiles;
 };
 
 
@@ -636,12 +772,13 @@ using SelectTileInfoIndexFunc = TStaticFuncPtr<int32(const FWFC3DCollapseContext
 
 /**
  * 단일 Cell Collapse 함수 포인터 타입
- * @param FWFC3DCell* - 붕괴할 Cell
+ * @param UWFC3DGrid* - 붕괴할 Cell이 속한 Grid
  * @param int32 - 붕괴할 Cell의 인덱스
+ * @param int32 - 붕괴할 Cell에 들어갈 TileInfo 인덱스
  * @param FTileInfo* - 붕괴할 Cell에 들어갈 TileInfo
  * @return bool - 붕괴 성공 여부
  */
-using CollapseSingleCellFunc = TStaticFuncPtr<bool(FWFC3DCell*, const int32, const FTileInfo*)>;
+using CollapseSingleCellFunc = TStaticFuncPtr<bool(UWFC3DGrid*, const int32, const int32, const FTileInfo*)>;
 
 /**
  * Collapse 알고리즘 함수 포인터 타입
@@ -673,6 +810,9 @@ enum class ECollapseCellSelectStrategy : uint8
 	/** 엔트로피 기반 셀 선택 */
 	ByEntropy UMETA(DisplayName = "By Entropy"),
 
+	/** 타일 가중치를 반영한 Shannon Entropy 기반 셀 선택 */
+	ByShannonEntropy UMETA(DisplayName = "By Shannon Entropy"),
+
 	/** 랜덤 셀 선택 */
 	Random UMETA(DisplayName = "Random"),
 
@@ -724,3 +864,22 @@ enum class ERangeLimitStrategy : uint8
 	/** Cube Range Limit */
 	CubeRangeLimited UMETA(DisplayName = "Cube Range Limited"),
 };
+
+/**
+ * 전파 방식 열거형
+ */
+UENUM(BlueprintType)
+enum class EPropagationMethod : uint8
+{
+	/** 이웃 도메인으로 셀 도메인을 다시 계산, 단계 당 셀을 한 번만 방문 (Default) */
+	DomainIntersection UMETA(DisplayName = "Domain Intersection"),
+
+	/** 도메인이 줄어든 셀의 이웃을 다시 방문하여 Arc Consistency 고정점까지 전파 */
+	Fixpoint UMETA(DisplayName = "Fixpoint"),
+
+	/** Frontier 단위로 셀을 병렬 계산하는 Fixpoint, 결과는 Fixpoint와 같음 */
+	ParallelFixpoint UMETA(DisplayName = "Parallel Fixpoint"),
+
+	/** 셀 / 방향 / 타일 별 지지 수를 유지하여 제거된 타일만 처리 (AC-4) */
+	SupportCounting UMETA(DisplayName = "Support Counting (AC-4)"),
+};
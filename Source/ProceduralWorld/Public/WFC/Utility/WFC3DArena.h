@@ -0,0 +1,297 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ContainerAllocationPolicies.h"
+
+/**
+ * 솔버 실행 단위 선형(Arena) 할당기
+ * 블록 단위로 메모리를 확보하고 앞에서부터 잘라서 할당하며, 개별 해제 없이 Mark / PopToMark로 한 번에 되돌립니다.
+ * 되돌린 블록은 해제하지 않고 다음 할당에서 재사용하므로, 블록이 충분해진 뒤에는 Arena가 전역 힙에서 블록을 할당하지 않습니다.
+ * GetBlockAllocationCount는 Arena 자신의 블록 할당만 셉니다. (Arena 밖의 할당은 포함하지 않음)
+ * 단일 스레드 전용이며, FWFC3DArenaScope로 현재 스레드의 Arena를 지정하면 TWFC3DArenaAllocator가 사용합니다.
+ */
+class PROCEDURALWORLD_API FWFC3DArena
+{
+public:
+	/** 기본 블록 크기 (64KB) */
+	static constexpr int64 DefaultBlockSize = 64 * 1024;
+
+	/** Arena의 할당 위치 */
+	struct FMark
+	{
+		int32 BlockIndex = 0;
+		int64 Offset = 0;
+	};
+
+	explicit FWFC3DArena(const int64 InBlockSize = DefaultBlockSize);
+	~FWFC3DArena();
+
+	FWFC3DArena(const FWFC3DArena&) = delete;
+	FWFC3DArena& operator=(const FWFC3DArena&) = delete;
+
+	/**
+	 * Size 바이트를 Alignment에 맞게 할당합니다.
+	 * 현재 블록에 공간이 없으면 다음 블록을 사용하고, 남은 블록이 없을 때만 전역 힙에서 새 블록을 할당합니다.
+	 */
+	void* Allocate(const SIZE_T Size, const uint32 Alignment);
+
+	/** 현재 위치 이후에 Bytes 바이트 이상 연속된 공간이 없으면 블록을 미리 할당합니다. */
+	void Reserve(const int64 Bytes);
+
+	FORCEINLINE FMark GetMark() const { return {CurrentBlockIndex, CurrentOffset}; }
+
+	/** Mark 이후의 모든 할당을 되돌립니다. (블록은 유지) */
+	FORCEINLINE void PopToMark(const FMark& Mark)
+	{
+		CurrentBlockIndex = Mark.BlockIndex;
+		CurrentOffset = Mark.Offset;
+	}
+
+	/** 모든 할당을 되돌립니다. (블록은 유지) */
+	FORCEINLINE void Reset() { PopToMark(FMark()); }
+
+	/** Arena에서 할당한 횟수 */
+	FORCEINLINE int64 GetAllocationCount() const { return AllocationCount; }
+
+	/** 전역 힙에서 블록을 할당한 횟수 (Arena 블록만 셈) */
+	FORCEINLINE int64 GetBlockAllocationCount() const { return BlockAllocationCount; }
+
+	/** 확보한 블록의 전체 크기 */
+	int64 GetReservedBytes() const;
+
+	/** 현재 스레드에서 사용 중인 Arena, 없으면 nullptr */
+	static FWFC3DArena* GetCurrent();
+
+private:
+	friend class FWFC3DArenaScope;
+
+	static void SetCurrent(FWFC3DArena* Arena);
+
+	struct FBlock
+	{
+		uint8* Data = nullptr;
+		int64 Size = 0;
+	};
+
+	TArray<FBlock, TInlineAllocator<16>> Blocks;
+
+	int32 CurrentBlockIndex = 0;
+
+	int64 CurrentOffset = 0;
+
+	int64 BlockSize = DefaultBlockSize;
+
+	int64 AllocationCount = 0;
+
+	int64 BlockAllocationCount = 0;
+};
+
+/**
+ * 범위 동안 현재 스레드의 Arena를 지정합니다.
+ * 범위가 끝나면 이전 Arena로 되돌립니다.
+ */
+class PROCEDURALWORLD_API FWFC3DArenaScope
+{
+public:
+	explicit FWFC3DArenaScope(FWFC3DArena& Arena)
+		: PreviousArena(FWFC3DArena::GetCurrent())
+	{
+		FWFC3DArena::SetCurrent(&Arena);
+	}
+
+	~FWFC3DArenaScope()
+	{
+		FWFC3DArena::SetCurrent(PreviousArena);
+	}
+
+	FWFC3DArenaScope(const FWFC3DArenaScope&) = delete;
+	FWFC3DArenaScope& operator=(const FWFC3DArenaScope&) = delete;
+
+private:
+	FWFC3DArena* PreviousArena;
+};
+
+/**
+ * 범위가 끝나면 현재 Arena를 범위 시작 위치로 되돌립니다. (FMemMark와 같은 역할)
+ * 현재 스레드에 Arena가 없으면 아무 동작도 하지 않습니다.
+ */
+class FWFC3DArenaMark
+{
+public:
+	FWFC3DArenaMark()
+		: Arena(FWFC3DArena::GetCurrent())
+	{
+		if (Arena != nullptr)
+		{
+			Mark = Arena->GetMark();
+		}
+	}
+
+	~FWFC3DArenaMark()
+	{
+		if (Arena != nullptr)
+		{
+			Arena->PopToMark(Mark);
+		}
+	}
+
+	FWFC3DArenaMark(const FWFC3DArenaMark&) = delete;
+	FWFC3DArenaMark& operator=(const FWFC3DArenaMark&) = delete;
+
+private:
+	FWFC3DArena* Arena;
+	FWFC3DArena::FMark Mark;
+};
+
+/**
+ * 현재 스레드의 FWFC3DArena에서 할당하는 TArray 할당 정책 (TMemStackAllocator와 같은 방식)
+ * 배열이 커지면 새 공간을 Arena에서 할당하고 복사하며, 이전 공간은 Arena가 되돌려질 때 함께 회수됩니다.
+ * 현재 스레드에 Arena가 없으면 전역 힙을 사용합니다.
+ * Arena에서 할당한 배열은 해당 FWFC3DArenaMark 범위 안에서만 사용해야 합니다.
+ */
+class TWFC3DArenaAllocator
+{
+public:
+	using SizeType = int32;
+
+	enum { NeedsElementType = true };
+	enum { RequireRangeCheck = true };
+
+	template <typename ElementType>
+	class ForElementType
+	{
+	public:
+		ForElementType() = default;
+
+		~ForElementType()
+		{
+			if (Data != nullptr && Arena == nullptr)
+			{
+				FMemory::Free(Data);
+			}
+		}
+
+		FORCEINLINE void MoveToEmpty(ForElementType& Other)
+		{
+			checkSlow(this != &Other);
+			if (Data != nullptr && Arena == nullptr)
+			{
+				FMemory::Free(Data);
+			}
+			Data = Other.Data;
+			Arena = Other.Arena;
+			Other.Data = nullptr;
+			Other.Arena = nullptr;
+		}
+
+		FORCEINLINE ElementType* GetAllocation() const { return Data; }
+
+		void ResizeAllocation(const SizeType CurrentNum, const SizeType NewMax, const SIZE_T NumBytesPerElement)
+		{
+			// 전역 힙에서 할당한 배열은 계속 전역 힙 사용
+			if (Data != nullptr && Arena == nullptr)
+			{
+				Data = static_cast<ElementType*>(FMemory::Realloc(Data, NewMax * NumBytesPerElement, alignof(ElementType)));
+				return;
+			}
+
+			if (NewMax == 0)
+			{
+				Data = nullptr;
+				return;
+			}
+
+			ElementType* OldData = Data;
+			Arena = FWFC3DArena::GetCurrent();
+			Data = Arena != nullptr
+				       ? static_cast<ElementType*>(Arena->Allocate(NewMax * NumBytesPerElement, alignof(ElementType)))
+				       : static_cast<ElementType*>(FMemory::Malloc(NewMax * NumBytesPerElement, alignof(ElementType)));
+
+			if (OldData != nullptr && CurrentNum > 0)
+			{
+				FMemory::Memcpy(Data, OldData, FMath::Min(NewMax, CurrentNum) * NumBytesPerElement);
+			}
+		}
+
+		FORCEINLINE SizeType CalculateSlackReserve(const SizeType NewMax, const SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackReserve(NewMax, NumBytesPerElement, false);
+		}
+
+		FORCEINLINE SizeType CalculateSlackShrink(const SizeType NewMax, const SizeType CurrentMax, const SIZE_T NumBytesPerElement) const
+		{
+			// Arena 공간은 개별 해제할 수 없으므로 줄이지 않음
+			return CurrentMax;
+		}
+
+		FORCEINLINE SizeType CalculateSlackGrow(const SizeType NewMax, const SizeType CurrentMax, const SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackGrow(NewMax, CurrentMax, NumBytesPerElement, false);
+		}
+
+		FORCEINLINE SIZE_T GetAllocatedSize(const SizeType CurrentMax, const SIZE_T NumBytesPerElement) const
+		{
+			return CurrentMax * NumBytesPerElement;
+		}
+
+		FORCEINLINE bool HasAllocation() const { return Data != nullptr; }
+
+		FORCEINLINE SizeType GetInitialCapacity() const { return 0; }
+
+	private:
+		ElementType* Data = nullptr;
+
+		/** Data를 할당한 Arena, 전역 힙이면 nullptr */
+		FWFC3DArena* Arena = nullptr;
+	};
+
+	typedef ForElementType<FScriptContainerElement> ForAnyElementType;
+};
+
+template <>
+struct TAllocatorTraits<TWFC3DArenaAllocator> : TAllocatorTraitsBase<TWFC3DArenaAllocator>
+{
+	enum { IsZeroConstruct = false };
+};
+
+/**
+ * Arena 배열 기반 FIFO 큐 (TQueue 대체)
+ * TQueue는 Enqueue마다 노드를 힙에 할당하므로, 배열 뒤에 추가하고 Head 위치에서 꺼냅니다.
+ * 큐가 비면 배열을 처음부터 다시 사용합니다.
+ */
+template <typename ElementType>
+class TWFC3DArenaQueue
+{
+public:
+	FORCEINLINE void Enqueue(const ElementType& Element)
+	{
+		Elements.Add(Element);
+	}
+
+	FORCEINLINE bool Dequeue(ElementType& OutElement)
+	{
+		if (IsEmpty())
+		{
+			return false;
+		}
+
+		OutElement = Elements[Head++];
+		if (Head == Elements.Num())
+		{
+			Elements.Reset();
+			Head = 0;
+		}
+		return true;
+	}
+
+	FORCEINLINE bool IsEmpty() const { return Head == Elements.Num(); }
+
+	FORCEINLINE void Reserve(const int32 Number) { Elements.Reserve(Number); }
+
+private:
+	TArray<ElementType, TWFC3DArenaAllocator> Elements;
+
+	int32 Head = 0;
+};
@@ -0,0 +1,159 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WFC/Data/WFC3DTypes.h"
+
+/**
+ * Grid 셀 인덱스 <-> 위치 변환 함수 모음
+ * - RowMajor: X + Y * DimX + Z * DimX * DimY
+ * - Morton: 각 축의 비트를 낮은 비트부터 X, Y, Z 순서로 교차 배치 (Z-order)
+ *   축 크기가 2의 거듭제곱이 아니거나 서로 다르면, 비트가 남은 축만 교차 배치합니다.
+ *   따라서 저장 공간은 각 축을 2의 거듭제곱으로 올림한 크기의 곱이 됩니다.
+ */
+class PROCEDURALWORLD_API FWFC3DCellLayoutUtils
+{
+public:
+	/**
+	 * 각 축 좌표를 표현하는 데 필요한 비트 수를 반환합니다.
+	 * @param Dimension - Grid 크기
+	 * @return 축 별 비트 수 (ceil(log2(Dim)))
+	 */
+	static FORCEINLINE FIntVector GetAxisBits(const FIntVector& Dimension)
+	{
+		return {
+			static_cast<int32>(FMath::CeilLogTwo(static_cast<uint32>(FMath::Max(Dimension.X, 1)))),
+			static_cast<int32>(FMath::CeilLogTwo(static_cast<uint32>(FMath::Max(Dimension.Y, 1)))),
+			static_cast<int32>(FMath::CeilLogTwo(static_cast<uint32>(FMath::Max(Dimension.Z, 1))))
+		};
+	}
+
+	/**
+	 * 레이아웃에 필요한 셀 저장 공간 크기를 반환합니다.
+	 * Morton 레이아웃은 Grid 밖의 빈 셀(Void Cell)을 포함합니다.
+	 */
+	static FORCEINLINE int32 GetStorageNum(const FIntVector& Dimension, const EWFC3DCellLayout Layout)
+	{
+		if (Layout == EWFC3DCellLayout::Morton)
+		{
+			const FIntVector AxisBits = GetAxisBits(Dimension);
+			return 1 << (AxisBits.X + AxisBits.Y + AxisBits.Z);
+		}
+		return Dimension.X * Dimension.Y * Dimension.Z;
+	}
+
+	static FORCEINLINE int32 LocationToRowMajorIndex(const FIntVector& Location, const FIntVector& Dimension)
+	{
+		return Location.X + Location.Y * Dimension.X + Location.Z * Dimension.X * Dimension.Y;
+	}
+
+	static FORCEINLINE FIntVector RowMajorIndexToLocation(const int32 Index, const FIntVector& Dimension)
+	{
+		return {Index % Dimension.X, Index / Dimension.X % Dimension.Y, Index / Dimension.X / Dimension.Y};
+	}
+
+	/**
+	 * 위치를 Morton 인덱스로 변환합니다.
+	 * @param Location - 셀 위치
+	 * @param AxisBits - GetAxisBits로 계산한 축 별 비트 수
+	 */
+	static int32 LocationToMortonIndex(const FIntVector& Location, const FIntVector& AxisBits)
+	{
+		int32 Index = 0;
+		int32 OutBit = 0;
+		const int32 MaxBits = FMath::Max3(AxisBits.X, AxisBits.Y, AxisBits.Z);
+		for (int32 Bit = 0; Bit < MaxBits; ++Bit)
+		{
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				if (Bit < AxisBits[Axis])
+				{
+					Index |= (Location[Axis] >> Bit & 1) << OutBit++;
+				}
+			}
+		}
+		return Index;
+	}
+
+	/**
+	 * Morton 인덱스를 위치로 변환합니다.
+	 * @param Index - Morton 인덱스
+	 * @param AxisBits - GetAxisBits로 계산한 축 별 비트 수
+	 */
+	static FIntVector MortonIndexToLocation(const int32 Index, const FIntVector& AxisBits)
+	{
+		FIntVector Location = FIntVector::ZeroValue;
+		int32 InBit = 0;
+		const int32 MaxBits = FMath::Max3(AxisBits.X, AxisBits.Y, AxisBits.Z);
+		for (int32 Bit = 0; Bit < MaxBits; ++Bit)
+		{
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				if (Bit < AxisBits[Axis])
+				{
+					Location[Axis] |= (Index >> InBit++ & 1) << Bit;
+				}
+			}
+		}
+		return Location;
+	}
+
+	/**
+	 * 축 별 인덱스 테이블을 생성합니다.
+	 * 셀 인덱스 = AxisTables[0][X] + AxisTables[1][Y] + AxisTables[2][Z]
+	 * Morton 레이아웃의 각 축 비트는 서로 겹치지 않으므로 덧셈으로 합성할 수 있습니다.
+	 */
+	static void BuildAxisIndexTables(const FIntVector& Dimension, const EWFC3DCellLayout Layout, TArray<int32> (&OutAxisTables)[3])
+	{
+		const FIntVector AxisBits = GetAxisBits(Dimension);
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			OutAxisTables[Axis].SetNumUninitialized(Dimension[Axis]);
+			for (int32 Coordinate = 0; Coordinate < Dimension[Axis]; ++Coordinate)
+			{
+				FIntVector Location = FIntVector::ZeroValue;
+				Location[Axis] = Coordinate;
+				OutAxisTables[Axis][Coordinate] = Layout == EWFC3DCellLayout::Morton
+					                                  ? LocationToMortonIndex(Location, AxisBits)
+					                                  : LocationToRowMajorIndex(Location, Dimension);
+			}
+		}
+	}
+
+	/** Morton 디코드 테이블의 바이트 청크 수 (int32 인덱스) */
+	static constexpr int32 MortonDecodeChunksNum = 4;
+
+	/**
+	 * Morton 인덱스의 바이트 별 위치 테이블을 생성합니다. (MortonDecodeChunksNum * 256 항목)
+	 * 각 축 비트는 서로 겹치지 않으므로 위치 = 바이트 별 테이블 값의 합입니다.
+	 */
+	static void BuildMortonDecodeTable(const FIntVector& AxisBits, TArray<FIntVector>& OutTable)
+	{
+		OutTable.SetNumUninitialized(MortonDecodeChunksNum * 256);
+		for (int32 Chunk = 0; Chunk < MortonDecodeChunksNum; ++Chunk)
+		{
+			for (int32 Byte = 0; Byte < 256; ++Byte)
+			{
+				OutTable[Chunk * 256 + Byte] = MortonIndexToLocation(static_cast<int32>(static_cast<uint32>(Byte) << (Chunk * 8)), AxisBits);
+			}
+		}
+	}
+
+	/** BuildMortonDecodeTable로 만든 테이블로 Morton 인덱스를 위치로 변환합니다. */
+	static FORCEINLINE FIntVector MortonIndexToLocation(const int32 Index, const TArray<FIntVector>& DecodeTable)
+	{
+		const uint32 UnsignedIndex = static_cast<uint32>(Index);
+		return DecodeTable[UnsignedIndex & 0xFF] + DecodeTable[256 + (UnsignedIndex >> 8 & 0xFF)] +
+			DecodeTable[512 + (UnsignedIndex >> 16 & 0xFF)] + DecodeTable[768 + (UnsignedIndex >> 24)];
+	}
+
+private:
+	/** 유틸리티 클래스 생성자 및 소멸자 제거 */
+	FWFC3DCellLayoutUtils() = delete;
+	FWFC3DCellLayoutUtils(const FWFC3DCellLayoutUtils&) = delete;
+	FWFC3DCellLayoutUtils& operator=(const FWFC3DCellLayoutUtils&) = delete;
+	FWFC3DCellLayoutUtils(FWFC3DCellLayoutUtils&&) = delete;
+	FWFC3DCellLayoutUtils& operator=(FWFC3DCellLayoutUtils&&) = delete;
+	~FWFC3DCellLayoutUtils() = delete;
+};
@@ -0,0 +1,88 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WFC3DDomainUtils.h"
+
+/**
+ * 전파 대기 셀 목록 (셀 인덱스 Ring Buffer)
+ * 셀 별 Queued 비트로 대기 중인 셀은 다시 추가하지 않으므로, 셀 수 크기의 버퍼가 넘치지 않습니다.
+ * Grid가 소유하여 단계마다 다시 할당하지 않고 재사용합니다.
+ */
+class PROCEDURALWORLD_API FWFC3DCellWorklist
+{
+public:
+	/**
+	 * 셀 수에 맞게 버퍼를 할당하고 비웁니다.
+	 * @param InCellsNum - Grid의 저장된 셀 수
+	 */
+	void Initialize(const int32 InCellsNum)
+	{
+		Ring.SetNumUninitialized(InCellsNum);
+		QueuedBits.Reset();
+		QueuedBits.SetNumZeroed(FWFC3DDomainUtils::GetWordsNum(InCellsNum));
+		Head = 0;
+		Tail = 0;
+		Count = 0;
+	}
+
+	/**
+	 * 셀을 목록 끝에 추가합니다.
+	 * @return 이미 대기 중인 셀이면 false
+	 */
+	FORCEINLINE bool Enqueue(const int32 CellIndex)
+	{
+		if (FWFC3DDomainUtils::TestBit(QueuedBits.GetData(), CellIndex))
+		{
+			return false;
+		}
+		checkSlow(Count < Ring.Num());
+		FWFC3DDomainUtils::SetBit(QueuedBits.GetData(), CellIndex);
+		Ring[Tail] = CellIndex;
+		Tail = Tail + 1 == Ring.Num() ? 0 : Tail + 1;
+		++Count;
+		return true;
+	}
+
+	FORCEINLINE bool Dequeue(int32& OutCellIndex)
+	{
+		if (Count == 0)
+		{
+			return false;
+		}
+		OutCellIndex = Ring[Head];
+		Head = Head + 1 == Ring.Num() ? 0 : Head + 1;
+		--Count;
+		FWFC3DDomainUtils::ClearBit(QueuedBits.GetData(), OutCellIndex);
+		return true;
+	}
+
+	FORCEINLINE bool IsEmpty() const { return Count == 0; }
+
+	FORCEINLINE bool IsQueued(const int32 CellIndex) const { return FWFC3DDomainUtils::TestBit(QueuedBits.GetData(), CellIndex); }
+
+	/** 남은 셀을 모두 꺼내 비웁니다. (전파 실패로 중간에 멈춘 경우) */
+	void Reset()
+	{
+		int32 CellIndex;
+		while (Dequeue(CellIndex))
+		{
+		}
+		Head = 0;
+		Tail = 0;
+	}
+
+private:
+	/** 셀 인덱스 Ring Buffer (셀 수 크기) */
+	TArray<int32> Ring;
+
+	/** 셀 별 대기 중 여부 */
+	TArray<uint64> QueuedBits;
+
+	int32 Head = 0;
+
+	int32 Tail = 0;
+
+	int32 Count = 0;
+};
@@ -0,0 +1,212 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/IntegralConstant.h"
+#include "WFC/Utility/WFC3DDomainUtils.h"
+
+/**
+ * 컴파일 타임 고정 크기 Tile 도메인 비트셋
+ * NumWords 개의 uint64 워드를 스택에 가지며, 모든 연산은 상수 길이로 FWFC3DDomainUtils의 벡터 연산을 호출하여 인라인 및 언롤됩니다.
+ * 연산은 Grid 비트 평면을 직접 가리키는 포인터에 대해서도 동작하도록 static 함수로 제공됩니다.
+ * (RuntimeNumWords 인자는 TWFCDomain<0>과 같은 시그니처를 유지하기 위한 것이며 무시됩니다.)
+ */
+template <int32 NumWords>
+struct TWFCDomain
+{
+	static_assert(NumWords > 0, "Use TWFCDomain<0> for runtime sized domains");
+
+	static constexpr bool bIsFixedSize = true;
+
+	explicit TWFCDomain(const int32 RuntimeNumWords = NumWords)
+	{
+		Clear(Words, RuntimeNumWords);
+	}
+
+	FORCEINLINE uint64* GetData() { return Words; }
+	FORCEINLINE const uint64* GetData() const { return Words; }
+
+	static FORCEINLINE constexpr int32 Num(const int32 RuntimeNumWords) { return NumWords; }
+
+	static FORCEINLINE void Clear(uint64* RESTRICT Dst, const int32 RuntimeNumWords)
+	{
+		for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+		{
+			Dst[WordIndex] = 0;
+		}
+	}
+
+	static FORCEINLINE void Copy(uint64* RESTRICT Dst, const uint64* RESTRICT Src, const int32 RuntimeNumWords)
+	{
+		for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+		{
+			Dst[WordIndex] = Src[WordIndex];
+		}
+	}
+
+	/** Dst &= Src */
+	static FORCEINLINE void And(uint64* RESTRICT Dst, const uint64* RESTRICT Src, const int32 RuntimeNumWords)
+	{
+		FWFC3DDomainUtils::AndInto(Dst, Src, NumWords);
+	}
+
+	/** Dst &= Src, 변경 여부와 결과 비트 수를 함께 반환 */
+	static FORCEINLINE FWFC3DDomainChange AndWithChange(uint64* RESTRICT Dst, const uint64* RESTRICT Src, const int32 RuntimeNumWords)
+	{
+		return FWFC3DDomainUtils::AndIntoWithChange(Dst, Src, NumWords);
+	}
+
+	/** Dst |= Src */
+	static FORCEINLINE void Or(uint64* RESTRICT Dst, const uint64* RESTRICT Src, const int32 RuntimeNumWords)
+	{
+		FWFC3DDomainUtils::OrInto(Dst, Src, NumWords);
+	}
+
+	static FORCEINLINE int32 CountSetBits(const uint64* Src, const int32 RuntimeNumWords)
+	{
+		return FWFC3DDomainUtils::CountSetBits(Src, NumWords);
+	}
+
+	static FORCEINLINE bool IsZero(const uint64* Src, const int32 RuntimeNumWords)
+	{
+		return FWFC3DDomainUtils::IsZero(Src, NumWords);
+	}
+
+	/** A와 B에 공통으로 1인 비트가 있는지 여부 */
+	static FORCEINLINE bool Intersects(const uint64* A, const uint64* B, const int32 RuntimeNumWords)
+	{
+		return FWFC3DDomainUtils::Intersects(A, B, NumWords);
+	}
+
+	/**
+	 * 처음으로 1인 비트의 인덱스를 반환합니다.
+	 * @return 1인 비트의 인덱스, 없으면 INDEX_NONE
+	 */
+	static FORCEINLINE int32 FindFirst(const uint64* Src, const int32 RuntimeNumWords)
+	{
+		for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+		{
+			if (Src[WordIndex] != 0)
+			{
+				return WordIndex * FWFC3DDomainUtils::BitsPerWord + static_cast<int32>(FMath::CountTrailingZeros64(Src[WordIndex]));
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	static FORCEINLINE int32 FindFrom(const uint64* Src, const int32 RuntimeNumWords, const int32 StartIndex)
+	{
+		return FWFC3DDomainUtils::FindFrom(Src, NumWords, StartIndex);
+	}
+
+	static FORCEINLINE FWFC3DSetBitRange GetSetBits(const uint64* Src, const int32 RuntimeNumWords)
+	{
+		return FWFC3DDomainUtils::GetSetBits(Src, NumWords);
+	}
+
+	uint64 Words[NumWords];
+};
+
+/**
+ * 런타임 크기 Tile 도메인 비트셋
+ * 고정 크기 인스턴스가 없는 큰 타일셋(> MaxFixedWords 워드)에서 사용됩니다.
+ */
+template <>
+struct TWFCDomain<0>
+{
+	static constexpr bool bIsFixedSize = false;
+
+	explicit TWFCDomain(const int32 RuntimeNumWords)
+	{
+		Words.SetNumZeroed(RuntimeNumWords);
+	}
+
+	FORCEINLINE uint64* GetData() { return Words.GetData(); }
+	FORCEINLINE const uint64* GetData() const { return Words.GetData(); }
+
+	static FORCEINLINE int32 Num(const int32 RuntimeNumWords) { return RuntimeNumWords; }
+
+	static FORCEINLINE void Clear(uint64* Dst, const int32 RuntimeNumWords)
+	{
+		FWFC3DDomainUtils::Clear(Dst, RuntimeNumWords);
+	}
+
+	static FORCEINLINE void Copy(uint64* Dst, const uint64* Src, const int32 RuntimeNumWords)
+	{
+		FWFC3DDomainUtils::Copy(Dst, Src, RuntimeNumWords);
+	}
+
+	static FORCEINLINE void And(uint64* Dst, const uint64* Src, const int32 RuntimeNumWords)
+	{
+		FWFC3DDomainUtils::AndInto(Dst, Src, RuntimeNumWords);
+	}
+
+	static FORCEINLINE FWFC3DDomainChange AndWithChange(uint64* Dst, const uint64* Src, const int32 RuntimeNumWords)
+	{
+		return FWFC3DDomainUtils::AndIntoWithChange(Dst, Src, RuntimeNumWords);
+	}
+
+	static FORCEINLINE void Or(uint64* Dst, const uint64* Src, const int32 RuntimeNumWords)
+	{
+		FWFC3DDomainUtils::OrInto(Dst, Src, RuntimeNumWords);
+	}
+
+	static FORCEINLINE int32 CountSetBits(const uint64* Src, const int32 RuntimeNumWords)
+	{
+		return FWFC3DDomainUtils::CountSetBits(Src, RuntimeNumWords);
+	}
+
+	static FORCEINLINE bool IsZero(const uint64* Src, const int32 RuntimeNumWords)
+	{
+		return FWFC3DDomainUtils::IsZero(Src, RuntimeNumWords);
+	}
+
+	static FORCEINLINE bool Intersects(const uint64* A, const uint64* B, const int32 RuntimeNumWords)
+	{
+		return FWFC3DDomainUtils::Intersects(A, B, RuntimeNumWords);
+	}
+
+	static FORCEINLINE int32 FindFirst(const uint64* Src, const int32 RuntimeNumWords)
+	{
+		return FWFC3DDomainUtils::FindFrom(Src, RuntimeNumWords, 0);
+	}
+
+	static FORCEINLINE int32 FindFrom(const uint64* Src, const int32 RuntimeNumWords, const int32 StartIndex)
+	{
+		return FWFC3DDomainUtils::FindFrom(Src, RuntimeNumWords, StartIndex);
+	}
+
+	static FORCEINLINE FWFC3DSetBitRange GetSetBits(const uint64* Src, const int32 RuntimeNumWords)
+	{
+		return FWFC3DDomainUtils::GetSetBits(Src, RuntimeNumWords);
+	}
+
+	TArray<uint64, TInlineAllocator<FWFC3DDomainUtils::MaxFixedWords>> Words;
+};
+
+/**
+ * 워드 수에 맞는 TWFCDomain 인스턴스를 선택하여 Functor를 호출합니다.
+ * Functor는 TIntegralConstant<int32, NumWords>를 인자로 받으며, NumWords가 0이면 런타임 크기 경로입니다.
+ * 예시: WFC3DDispatchDomainWords(Grid->GetTileWordsNum(), [&](auto WordsTag) { return Kernel<decltype(WordsTag)::Value>(...); });
+ * @param NumWords - FWFC3DDomainUtils::GetAlignedWordsNum으로 정렬된 워드 수
+ */
+template <typename FunctorType>
+FORCEINLINE decltype(auto) WFC3DDispatchDomainWords(const int32 NumWords, FunctorType&& Functor)
+{
+	switch (NumWords)
+	{
+	case 1:
+		return Functor(TIntegralConstant<int32, 1>());
+	case 2:
+		return Functor(TIntegralConstant<int32, 2>());
+	case 4:
+		return Functor(TIntegralConstant<int32, 4>());
+	case 8:
+		return Functor(TIntegralConstant<int32, 8>());
+	case 16:
+		return Functor(TIntegralConstant<int32, 16>());
+	default:
+		return Functor(TIntegralConstant<int32, 0>());
+	}
+}
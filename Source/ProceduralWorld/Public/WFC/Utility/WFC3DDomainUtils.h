@@ -0,0 +1,428 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 도메인 연산에 벡터 레지스터(VectorRegister4Int, x64 SSE / ARM NEON)를 사용할지 여부
+ * 벡터 명령을 사용할 수 없는 플랫폼에서는 워드 단위 스칼라 루프를 사용합니다.
+ */
+#ifndef WFC3D_DOMAIN_SIMD
+#define WFC3D_DOMAIN_SIMD PLATFORM_ENABLE_VECTORINTRINSICS
+#endif
+
+/**
+ * 도메인 And 연산 결과
+ * 연산과 함께 계산되므로 변경 여부 확인이나 Entropy 갱신에 결과 도메인을 다시 읽지 않습니다.
+ */
+struct FWFC3DDomainChange
+{
+	/** 연산으로 지워진 비트가 있는지 여부 */
+	bool bChanged = false;
+
+	/** 결과 도메인의 1인 비트 수 */
+	int32 SetBitsNum = 0;
+};
+
+class FWFC3DSetBitRange;
+
+/**
+ * uint64 워드 배열로 표현된 Tile / Face 도메인 비트셋 연산 모음
+ * UWFC3DGrid의 비트 평면(Bit Plane)에 직접 접근할 때 사용됩니다.
+ */
+class PROCEDURALWORLD_API FWFC3DDomainUtils
+{
+public:
+	/** 워드 하나의 비트 수 */
+	static constexpr int32 BitsPerWord = 64;
+
+	/**
+	 * 비트 수에 맞는 워드 수를 반환합니다.
+	 * @param NumBits - 비트 수
+	 * @return NumBits를 담을 수 있는 최소 워드 수
+	 */
+	static FORCEINLINE int32 GetWordsNum(const int32 NumBits)
+	{
+		return (NumBits + BitsPerWord - 1) / BitsPerWord;
+	}
+
+	/** 고정 크기 도메인(TWFCDomain)이 인스턴스화되는 최대 워드 수 (1024 타일) */
+	static constexpr int32 MaxFixedWords = 16;
+
+	/**
+	 * 고정 크기 도메인 인스턴스(1, 2, 4, 8, 16 워드)에 맞게 올림한 워드 수를 반환합니다.
+	 * MaxFixedWords를 넘으면 GetWordsNum과 같습니다. 올림으로 생긴 워드는 항상 0으로 유지됩니다.
+	 */
+	static FORCEINLINE int32 GetAlignedWordsNum(const int32 NumBits)
+	{
+		const int32 WordsNum = GetWordsNum(NumBits);
+		if (WordsNum <= 1 || WordsNum > MaxFixedWords)
+		{
+			return FMath::Max(WordsNum, 1);
+		}
+		return static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(WordsNum)));
+	}
+
+	/** 앞쪽 NumBits 비트만 1로 설정하고 나머지 비트는 0으로 설정합니다. */
+	static FORCEINLINE void SetAll(uint64* Words, const int32 NumWords, const int32 NumBits)
+	{
+		for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+		{
+			const int32 RemainingBits = NumBits - WordIndex * BitsPerWord;
+			if (RemainingBits >= BitsPerWord)
+			{
+				Words[WordIndex] = ~uint64(0);
+			}
+			else if (RemainingBits > 0)
+			{
+				Words[WordIndex] = (uint64(1) << RemainingBits) - 1;
+			}
+			else
+			{
+				Words[WordIndex] = 0;
+			}
+		}
+	}
+
+	/** 모든 비트를 0으로 설정합니다. */
+	static FORCEINLINE void Clear(uint64* Words, const int32 NumWords)
+	{
+		FMemory::Memzero(Words, NumWords * sizeof(uint64));
+	}
+
+	static FORCEINLINE void Copy(uint64* Dst, const uint64* Src, const int32 NumWords)
+	{
+		FMemory::Memcpy(Dst, Src, NumWords * sizeof(uint64));
+	}
+
+	static FORCEINLINE void SetBit(uint64* Words, const int32 BitIndex)
+	{
+		Words[BitIndex / BitsPerWord] |= uint64(1) << (BitIndex % BitsPerWord);
+	}
+
+	static FORCEINLINE void ClearBit(uint64* Words, const int32 BitIndex)
+	{
+		Words[BitIndex / BitsPerWord] &= ~(uint64(1) << (BitIndex % BitsPerWord));
+	}
+
+	static FORCEINLINE bool TestBit(const uint64* Words, const int32 BitIndex)
+	{
+		return (Words[BitIndex / BitsPerWord] >> (BitIndex % BitsPerWord) & 1) != 0;
+	}
+
+	/** Dst &= Src */
+	static FORCEINLINE void AndInto(uint64* Dst, const uint64* Src, const int32 NumWords)
+	{
+		int32 WordIndex = 0;
+#if WFC3D_DOMAIN_SIMD
+		for (; WordIndex + WordsPerVector <= NumWords; WordIndex += WordsPerVector)
+		{
+			VectorIntStore(VectorIntAnd(VectorIntLoad(Dst + WordIndex), VectorIntLoad(Src + WordIndex)), Dst + WordIndex);
+		}
+#endif
+		for (; WordIndex < NumWords; ++WordIndex)
+		{
+			Dst[WordIndex] &= Src[WordIndex];
+		}
+	}
+
+	/** Dst |= Src */
+	static FORCEINLINE void OrInto(uint64* Dst, const uint64* Src, const int32 NumWords)
+	{
+		int32 WordIndex = 0;
+#if WFC3D_DOMAIN_SIMD
+		for (; WordIndex + WordsPerVector <= NumWords; WordIndex += WordsPerVector)
+		{
+			VectorIntStore(VectorIntOr(VectorIntLoad(Dst + WordIndex), VectorIntLoad(Src + WordIndex)), Dst + WordIndex);
+		}
+#endif
+		for (; WordIndex < NumWords; ++WordIndex)
+		{
+			Dst[WordIndex] |= Src[WordIndex];
+		}
+	}
+
+	/**
+	 * Dst &= Src를 계산하면서 변경 여부와 결과 비트 수를 함께 구합니다.
+	 * 같은 루프에서 방금 쓴 워드의 비트 수를 세므로 CountSetBits로 결과를 다시 읽지 않습니다.
+	 */
+	static FORCEINLINE FWFC3DDomainChange AndIntoWithChange(uint64* Dst, const uint64* Src, const int32 NumWords)
+	{
+		FWFC3DDomainChange Result;
+		uint64 Removed = 0;
+		int32 WordIndex = 0;
+#if WFC3D_DOMAIN_SIMD
+		VectorRegister4Int RemovedVector = GlobalVectorConstants::IntZero;
+		for (; WordIndex + WordsPerVector <= NumWords; WordIndex += WordsPerVector)
+		{
+			const VectorRegister4Int OldWords = VectorIntLoad(Dst + WordIndex);
+			const VectorRegister4Int NewWords = VectorIntAnd(OldWords, VectorIntLoad(Src + WordIndex));
+			RemovedVector = VectorIntOr(RemovedVector, VectorIntXor(OldWords, NewWords));
+			VectorIntStore(NewWords, Dst + WordIndex);
+			Result.SetBitsNum += static_cast<int32>(FMath::CountBits(Dst[WordIndex]) + FMath::CountBits(Dst[WordIndex + 1]));
+		}
+		Removed |= ReduceOr(RemovedVector);
+#endif
+		for (; WordIndex < NumWords; ++WordIndex)
+		{
+			const uint64 NewWord = Dst[WordIndex] & Src[WordIndex];
+			Removed |= Dst[WordIndex] ^ NewWord;
+			Dst[WordIndex] = NewWord;
+			Result.SetBitsNum += static_cast<int32>(FMath::CountBits(NewWord));
+		}
+		Result.bChanged = Removed != 0;
+		return Result;
+	}
+
+	/** A와 B에 공통으로 1인 비트가 있는지 여부 */
+	static FORCEINLINE bool Intersects(const uint64* A, const uint64* B, const int32 NumWords)
+	{
+		uint64 Accumulated = 0;
+		int32 WordIndex = 0;
+#if WFC3D_DOMAIN_SIMD
+		VectorRegister4Int AccumulatedVector = GlobalVectorConstants::IntZero;
+		for (; WordIndex + WordsPerVector <= NumWords; WordIndex += WordsPerVector)
+		{
+			AccumulatedVector = VectorIntOr(AccumulatedVector, VectorIntAnd(VectorIntLoad(A + WordIndex), VectorIntLoad(B + WordIndex)));
+		}
+		Accumulated |= ReduceOr(AccumulatedVector);
+#endif
+		for (; WordIndex < NumWords; ++WordIndex)
+		{
+			Accumulated |= A[WordIndex] & B[WordIndex];
+		}
+		return Accumulated != 0;
+	}
+
+	/** 모든 비트가 0인지 여부 */
+	static FORCEINLINE bool IsZero(const uint64* Words, const int32 NumWords)
+	{
+		uint64 Accumulated = 0;
+		int32 WordIndex = 0;
+#if WFC3D_DOMAIN_SIMD
+		VectorRegister4Int AccumulatedVector = GlobalVectorConstants::IntZero;
+		for (; WordIndex + WordsPerVector <= NumWords; WordIndex += WordsPerVector)
+		{
+			AccumulatedVector = VectorIntOr(AccumulatedVector, VectorIntLoad(Words + WordIndex));
+		}
+		Accumulated |= ReduceOr(AccumulatedVector);
+#endif
+		for (; WordIndex < NumWords; ++WordIndex)
+		{
+			Accumulated |= Words[WordIndex];
+		}
+		return Accumulated == 0;
+	}
+
+	/** A와 B의 모든 비트가 같은지 여부 (다른 비트를 Xor로 누적) */
+	static FORCEINLINE bool Equals(const uint64* A, const uint64* B, const int32 NumWords)
+	{
+		uint64 Accumulated = 0;
+		int32 WordIndex = 0;
+#if WFC3D_DOMAIN_SIMD
+		VectorRegister4Int AccumulatedVector = GlobalVectorConstants::IntZero;
+		for (; WordIndex + WordsPerVector <= NumWords; WordIndex += WordsPerVector)
+		{
+			AccumulatedVector = VectorIntOr(AccumulatedVector, VectorIntXor(VectorIntLoad(A + WordIndex), VectorIntLoad(B + WordIndex)));
+		}
+		Accumulated |= ReduceOr(AccumulatedVector);
+#endif
+		for (; WordIndex < NumWords; ++WordIndex)
+		{
+			Accumulated |= A[WordIndex] ^ B[WordIndex];
+		}
+		return Accumulated == 0;
+	}
+
+	/**
+	 * 1인 비트 수
+	 * SSE4.2 / NEON에는 64비트 레인 Popcount가 없으므로 워드 단위 하드웨어 Popcount를 두 누산기로 나누어 의존성을 줄입니다.
+	 */
+	static FORCEINLINE int32 CountSetBits(const uint64* Words, const int32 NumWords)
+	{
+		uint64 CountA = 0;
+		uint64 CountB = 0;
+		int32 WordIndex = 0;
+		for (; WordIndex + 2 <= NumWords; WordIndex += 2)
+		{
+			CountA += FMath::CountBits(Words[WordIndex]);
+			CountB += FMath::CountBits(Words[WordIndex + 1]);
+		}
+		if (WordIndex < NumWords)
+		{
+			CountA += FMath::CountBits(Words[WordIndex]);
+		}
+		return static_cast<int32>(CountA + CountB);
+	}
+
+	/** A와 B에 공통으로 1인 비트 수 */
+	static FORCEINLINE int32 CountCommonBits(const uint64* A, const uint64* B, const int32 NumWords)
+	{
+		int32 Count = 0;
+		for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+		{
+			Count += static_cast<int32>(FMath::CountBits(A[WordIndex] & B[WordIndex]));
+		}
+		return Count;
+	}
+
+	/**
+	 * StartIndex 이후 처음으로 1인 비트의 인덱스를 반환합니다.
+	 * @return 1인 비트의 인덱스, 없으면 INDEX_NONE
+	 */
+	static FORCEINLINE int32 FindFrom(const uint64* Words, const int32 NumWords, const int32 StartIndex)
+	{
+		int32 WordIndex = StartIndex / BitsPerWord;
+		if (WordIndex >= NumWords)
+		{
+			return INDEX_NONE;
+		}
+
+		uint64 Word = Words[WordIndex] & (~uint64(0) << (StartIndex % BitsPerWord));
+		while (Word == 0)
+		{
+			if (++WordIndex >= NumWords)
+			{
+				return INDEX_NONE;
+			}
+			Word = Words[WordIndex];
+		}
+		return WordIndex * BitsPerWord + static_cast<int32>(FMath::CountTrailingZeros64(Word));
+	}
+
+	/**
+	 * 1인 비트의 인덱스를 오름차순으로 순회하는 범위 (range-for 용, 할당 없음)
+	 * for (const int32 TileIndex : FWFC3DDomainUtils::GetSetBits(TileOptions, TileWordsNum))
+	 */
+	static FWFC3DSetBitRange GetSetBits(const uint64* Words, const int32 NumWords);
+
+	/**
+	 * 도메인을 0과 1로 구성된 문자열로 변환합니다. (디버그용)
+	 */
+	static FString ToString(const uint64* Words, const int32 NumBits)
+	{
+		FString BitString;
+		BitString.Reserve(NumBits);
+		for (int32 BitIndex = 0; BitIndex < NumBits; ++BitIndex)
+		{
+			BitString += TestBit(Words, BitIndex) ? TEXT("1") : TEXT("0");
+		}
+		return BitString;
+	}
+
+	/**
+	 * TBitArray를 워드 배열로 복사합니다.
+	 * @param BitArray - 원본 비트 배열
+	 * @param OutWords - NumWords 크기의 워드 배열
+	 * @param NumWords - 워드 수
+	 */
+	static void FromBitArray(const TBitArray<>& BitArray, uint64* OutWords, const int32 NumWords)
+	{
+		Clear(OutWords, NumWords);
+		for (TConstSetBitIterator<> It(BitArray); It; ++It)
+		{
+			if (It.GetIndex() < NumWords * BitsPerWord)
+			{
+				SetBit(OutWords, It.GetIndex());
+			}
+		}
+	}
+
+private:
+#if WFC3D_DOMAIN_SIMD
+	/** 벡터 레지스터 하나의 워드 수 (128비트) */
+	static constexpr int32 WordsPerVector = 2;
+
+	/** 벡터 레지스터의 두 워드를 OR 한 값 */
+	static FORCEINLINE uint64 ReduceOr(const VectorRegister4Int& Vector)
+	{
+		alignas(16) uint64 Words[WordsPerVector];
+		VectorIntStoreAligned(Vector, Words);
+		return Words[0] | Words[1];
+	}
+#endif
+
+	/** 유틸리티 클래스 생성자 및 소멸자 제거 */
+	FWFC3DDomainUtils() = delete;
+	FWFC3DDomainUtils(const FWFC3DDomainUtils&) = delete;
+	FWFC3DDomainUtils& operator=(const FWFC3DDomainUtils&) = delete;
+	FWFC3DDomainUtils(FWFC3DDomainUtils&&) = delete;
+	FWFC3DDomainUtils& operator=(FWFC3DDomainUtils&&) = delete;
+	~FWFC3DDomainUtils() = delete;
+};
+
+/** FWFC3DSetBitIterator의 끝 표시 */
+struct FWFC3DSetBitEnd
+{
+};
+
+/**
+ * 도메인의 1인 비트 인덱스 반복자
+ * 현재 워드의 가장 낮은 1인 비트를 CountTrailingZeros로 찾고 지워 가며 진행하므로, 비트 당 비용이 일정하고 빈 워드는 한 번에 건너뜁니다.
+ * 현재 워드는 복사본이므로 순회 중 도메인이 바뀌면 다음 워드부터 반영됩니다. (바뀔 수 있으면 FindFrom 사용)
+ */
+class FWFC3DSetBitIterator
+{
+public:
+	FORCEINLINE FWFC3DSetBitIterator(const uint64* InWords, const int32 InNumWords)
+		: Words(InWords), NumWords(InNumWords), Word(InNumWords > 0 ? InWords[0] : 0)
+	{
+		SkipEmptyWords();
+	}
+
+	FORCEINLINE int32 operator*() const
+	{
+		return WordIndex * FWFC3DDomainUtils::BitsPerWord + static_cast<int32>(FMath::CountTrailingZeros64(Word));
+	}
+
+	FORCEINLINE FWFC3DSetBitIterator& operator++()
+	{
+		Word &= Word - 1;
+		SkipEmptyWords();
+		return *this;
+	}
+
+	FORCEINLINE bool operator!=(FWFC3DSetBitEnd) const { return WordIndex < NumWords; }
+
+private:
+	FORCEINLINE void SkipEmptyWords()
+	{
+		while (Word == 0 && ++WordIndex < NumWords)
+		{
+			Word = Words[WordIndex];
+		}
+	}
+
+	const uint64* Words;
+
+	int32 NumWords;
+
+	int32 WordIndex = 0;
+
+	/** 현재 워드에서 아직 순회하지 않은 비트 */
+	uint64 Word;
+};
+
+/** FWFC3DDomainUtils::GetSetBits가 반환하는 범위 */
+class FWFC3DSetBitRange
+{
+public:
+	FORCEINLINE FWFC3DSetBitRange(const uint64* InWords, const int32 InNumWords)
+		: Words(InWords), NumWords(InNumWords)
+	{
+	}
+
+	FORCEINLINE FWFC3DSetBitIterator begin() const { return FWFC3DSetBitIterator(Words, NumWords); }
+	FORCEINLINE FWFC3DSetBitEnd end() const { return FWFC3DSetBitEnd(); }
+
+private:
+	const uint64* Words;
+
+	int32 NumWords;
+};
+
+FORCEINLINE FWFC3DSetBitRange FWFC3DDomainUtils::GetSetBits(const uint64* Words, const int32 NumWords)
+{
+	return FWFC3DSetBitRange(Words, NumWords);
+}
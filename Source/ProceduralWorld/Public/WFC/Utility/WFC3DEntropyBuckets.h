@@ -0,0 +1,110 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Entropy 별 셀 버킷 (인덱스 우선순위 큐)
+ * 셀 별 버킷과 버킷 안의 위치를 기록하여 추가, 갱신, 제거가 O(1)이며,
+ * 가장 낮은 비어 있지 않은 버킷을 가리키는 커서로 최소 Entropy 셀을 Grid 순회 없이 찾습니다.
+ * 전파 중 Entropy는 줄어들기만 하므로 커서는 대부분 제자리이거나 앞으로만 이동합니다. (분할 상환 O(1))
+ */
+class PROCEDURALWORLD_API FWFC3DEntropyBuckets
+{
+public:
+	/**
+	 * 셀 수와 최대 Entropy에 맞게 버퍼를 할당하고 비웁니다.
+	 * @param InCellsNum - Grid의 저장된 셀 수
+	 * @param InMaxEntropy - 가능한 최대 Entropy (타일 수)
+	 */
+	void Initialize(const int32 InCellsNum, const int32 InMaxEntropy)
+	{
+		Buckets.SetNum(InMaxEntropy + 1);
+		for (TArray<int32>& Bucket : Buckets)
+		{
+			Bucket.Reset();
+		}
+		CellBuckets.Init(INDEX_NONE, InCellsNum);
+		CellPositions.Init(INDEX_NONE, InCellsNum);
+		MinBucket = 0;
+		Count = 0;
+	}
+
+	FORCEINLINE bool Contains(const int32 CellIndex) const { return CellBuckets[CellIndex] != INDEX_NONE; }
+
+	FORCEINLINE void Add(const int32 CellIndex, const int32 Entropy)
+	{
+		checkSlow(!Contains(CellIndex) && Buckets.IsValidIndex(Entropy));
+		CellBuckets[CellIndex] = Entropy;
+		CellPositions[CellIndex] = Buckets[Entropy].Add(CellIndex);
+		MinBucket = FMath::Min(MinBucket, Entropy);
+		++Count;
+	}
+
+	/** 셀을 제거합니다. (버킷의 마지막 셀을 빈 자리로 옮김) */
+	FORCEINLINE void Remove(const int32 CellIndex)
+	{
+		const int32 Entropy = CellBuckets[CellIndex];
+		if (Entropy == INDEX_NONE)
+		{
+			return;
+		}
+		TArray<int32>& Bucket = Buckets[Entropy];
+		const int32 Position = CellPositions[CellIndex];
+		const int32 LastCellIndex = Bucket.Last();
+		Bucket[Position] = LastCellIndex;
+		CellPositions[LastCellIndex] = Position;
+		Bucket.Pop();
+		CellBuckets[CellIndex] = INDEX_NONE;
+		CellPositions[CellIndex] = INDEX_NONE;
+		--Count;
+	}
+
+	/** 버킷에 있는 셀의 Entropy를 갱신합니다. */
+	FORCEINLINE void Update(const int32 CellIndex, const int32 Entropy)
+	{
+		if (CellBuckets[CellIndex] != Entropy)
+		{
+			Remove(CellIndex);
+			Add(CellIndex, Entropy);
+		}
+	}
+
+	/**
+	 * 가장 낮은 Entropy를 찾습니다.
+	 * @return 셀이 있는 가장 낮은 Entropy, 비어 있으면 INDEX_NONE
+	 */
+	FORCEINLINE int32 FindMinEntropy()
+	{
+		if (Count == 0)
+		{
+			return INDEX_NONE;
+		}
+		while (Buckets[MinBucket].IsEmpty())
+		{
+			++MinBucket;
+		}
+		return MinBucket;
+	}
+
+	/** Entropy 버킷의 셀 목록 (순서는 추가 / 제거에 따라 바뀜) */
+	FORCEINLINE TConstArrayView<int32> GetBucket(const int32 Entropy) const { return Buckets[Entropy]; }
+
+	FORCEINLINE int32 Num() const { return Count; }
+
+private:
+	/** Entropy 별 셀 인덱스 */
+	TArray<TArray<int32>> Buckets;
+
+	/** 셀 별 버킷 (Entropy), 버킷에 없으면 INDEX_NONE */
+	TArray<int32> CellBuckets;
+
+	/** 셀 별 버킷 안의 위치 */
+	TArray<int32> CellPositions;
+
+	/** 비어 있지 않은 가장 낮은 버킷 이하의 커서 */
+	int32 MinBucket = 0;
+
+	int32 Count = 0;
+};
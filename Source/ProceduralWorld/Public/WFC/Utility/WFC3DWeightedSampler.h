@@ -0,0 +1,58 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WFC/Utility/WFC3DDomainUtils.h"
+
+/**
+ * 타일 가중치 비율로 도메인에서 타일을 뽑는 함수 모음
+ * 인덱스 배열이나 가중치 배열을 만들지 않고 도메인 워드와 ModelData의 평면 가중치 배열을 직접 읽습니다.
+ */
+class PROCEDURALWORLD_API FWFC3DWeightedSampler
+{
+public:
+	/**
+	 * 도메인의 타일 중 하나를 가중치 비율로 선택합니다.
+	 * 워드 별 가중치 합을 한 번에 계산한 뒤, 뽑은 값이 속한 워드 안에서만 비트를 순회합니다.
+	 * @param TileOptions - 도메인 (TileWordsNum 워드)
+	 * @param TileWordsNum - 도메인 워드 수
+	 * @param TileWeights - 타일 별 가중치 (TileWordsNum * 64개, 도메인 밖 타일은 0)
+	 * @param RandomStream - 랜덤 스트림
+	 * @return 선택된 타일 인덱스, 도메인이 비어 있으면 INDEX_NONE (가중치 합이 0이면 첫 번째 타일)
+	 */
+	static int32 SampleDomain(const uint64* TileOptions, const int32 TileWordsNum, const float* TileWeights, const FRandomStream& RandomStream);
+
+	/**
+	 * Alias 테이블로 전체 타일 중 하나를 가중치 비율로 O(1)에 선택합니다.
+	 * @param Probabilities - 타일 별 자신을 선택할 확률
+	 * @param Aliases - 자신을 선택하지 않을 때 선택할 타일
+	 * @param RandomStream - 랜덤 스트림
+	 */
+	static FORCEINLINE int32 SampleAlias(TConstArrayView<float> Probabilities, TConstArrayView<int32> Aliases, const FRandomStream& RandomStream)
+	{
+		const int32 TileIndex = RandomStream.RandHelper(Probabilities.Num());
+		return RandomStream.FRand() < Probabilities[TileIndex] ? TileIndex : Aliases[TileIndex];
+	}
+
+	/**
+	 * 가중치 배열로 Alias 테이블을 구성합니다. (Vose 방식)
+	 * @param Weights - 타일 별 가중치 (음수 없음)
+	 * @param OutProbabilities - 타일 별 자신을 선택할 확률
+	 * @param OutAliases - 자신을 선택하지 않을 때 선택할 타일
+	 * @return 가중치 합이 0보다 커서 테이블을 만들었으면 true (아니면 출력 배열은 비어 있음)
+	 */
+	static bool BuildAliasTable(TConstArrayView<double> Weights, TArray<float>& OutProbabilities, TArray<int32>& OutAliases);
+
+private:
+	/** 워드 하나의 1인 비트에 해당하는 가중치 합 */
+	static float GetWordWeight(const uint64 Word, const float* WordWeights);
+
+	/** 유틸리티 클래스 생성자 및 소멸자 제거 */
+	FWFC3DWeightedSampler() = delete;
+	FWFC3DWeightedSampler(const FWFC3DWeightedSampler&) = delete;
+	FWFC3DWeightedSampler& operator=(const FWFC3DWeightedSampler&) = delete;
+	FWFC3DWeightedSampler(FWFC3DWeightedSampler&&) = delete;
+	FWFC3DWeightedSampler& operator=(FWFC3DWeightedSampler&&) = delete;
+	~FWFC3DWeightedSampler() = delete;
+};